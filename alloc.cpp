@@ -0,0 +1,150 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "include/alloc.hpp"
+#include "include/log.hpp"
+#include "include/macros.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+using namespace std;
+
+namespace mem {
+
+namespace {
+   static const size_t hugePageSize = 2*1024*1024;
+   // Smaller allocations are not worth a mapping of their own
+   static const size_t minMappedSize = 64*1024;
+   static const int mpolInterleave = 3; // MPOL_INTERLEAVE from linux/mempolicy.h
+
+   enum class HugePages { Off, Thp, HugeTlb };
+
+   struct Config {
+      HugePages hugePages;
+      bool interleave;
+      vector<unsigned long> nodeMask;
+      unsigned long maxNode;
+
+      Config() : hugePages(HugePages::Off), interleave(false), maxNode(0) {
+         const char* hugePagesStr = getenv("HUGE_PAGES");
+         if(hugePagesStr!=nullptr) {
+            const string value(hugePagesStr);
+            if(value=="thp") {
+               hugePages = HugePages::Thp;
+            } else if(value=="hugetlb") {
+               hugePages = HugePages::HugeTlb;
+            } else if(value!="off") {
+               FATAL_ERROR("[Alloc] Unknown HUGE_PAGES value "<<value);
+            }
+         }
+
+         const char* numaStr = getenv("NUMA_POLICY");
+         if(numaStr!=nullptr) {
+            const string value(numaStr);
+            if(value=="interleave") {
+               interleave = readOnlineNodes();
+            } else if(value!="firsttouch") {
+               FATAL_ERROR("[Alloc] Unknown NUMA_POLICY value "<<value);
+            }
+         }
+      }
+
+      // Parses the online node list, e.g., "0-1,4". Returns false if there is only one node.
+      bool readOnlineNodes() {
+         ifstream file("/sys/devices/system/node/online");
+         string nodes;
+         if(!(file>>nodes)) {
+            return false;
+         }
+
+         unsigned numNodes = 0;
+         size_t pos = 0;
+         while(pos<nodes.size()) {
+            size_t end = nodes.find(',', pos);
+            if(end==string::npos) { end = nodes.size(); }
+            const string range = nodes.substr(pos, end-pos);
+            const size_t dash = range.find('-');
+            const unsigned first = stoul(range.substr(0, dash));
+            const unsigned last = dash==string::npos ? first : stoul(range.substr(dash+1));
+            for(unsigned node=first; node<=last; node++) {
+               const unsigned bits = sizeof(unsigned long)*8;
+               if(nodeMask.size()<=node/bits) {
+                  nodeMask.resize(node/bits+1);
+               }
+               nodeMask[node/bits] |= 1ul<<(node%bits);
+               numNodes++;
+            }
+            pos = end+1;
+         }
+         maxNode = nodeMask.size()*sizeof(unsigned long)*8+1;
+         return numNodes>1;
+      }
+
+      size_t mappedSize(size_t size) const {
+         return hugePages==HugePages::HugeTlb ? (size+hugePageSize-1)/hugePageSize*hugePageSize : size;
+      }
+   };
+
+   const Config& config() {
+      static const Config config;
+      return config;
+   }
+
+   void* mapAnonymous(size_t size, int extraFlags) {
+      void* ptr = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|extraFlags, -1, 0);
+      return ptr==MAP_FAILED ? nullptr : ptr;
+   }
+}
+
+void* allocate(size_t size) {
+   const Config& conf = config();
+   if(size<minMappedSize) {
+      void* ptr;
+      if(unlikely(posix_memalign(&ptr, 64, size)!=0)) {
+         FATAL_ERROR("[Alloc] Could not allocate "<<size<<" bytes");
+      }
+      memset(ptr, 0, size);
+      return ptr;
+   }
+
+   const size_t mappedSize = conf.mappedSize(size);
+   void* ptr = nullptr;
+   if(conf.hugePages==HugePages::HugeTlb) {
+      ptr = mapAnonymous(mappedSize, MAP_HUGETLB);
+   }
+   if(ptr==nullptr) {
+      ptr = mapAnonymous(mappedSize, 0);
+      if(ptr==nullptr) {
+         FATAL_ERROR("[Alloc] Could not map "<<mappedSize<<" bytes");
+      }
+      if(conf.hugePages!=HugePages::Off) {
+         madvise(ptr, mappedSize, MADV_HUGEPAGE);
+      }
+   }
+
+   // Pages are placed when first touched, so the policy has to be set before
+   if(conf.interleave) {
+      syscall(SYS_mbind, ptr, mappedSize, mpolInterleave, conf.nodeMask.data(), conf.maxNode, 0);
+   }
+   return ptr;
+}
+
+void release(void* ptr, size_t size) {
+   if(ptr==nullptr) {
+      return;
+   }
+   if(size<minMappedSize) {
+      free(ptr);
+   } else {
+      munmap(ptr, config().mappedSize(size));
+   }
+}
+
+}
@@ -0,0 +1,39 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "include/dispatch.hpp"
+
+// Compiled with the AVX2 target flags, only called if the host supports them
+
+namespace dispatch {
+
+BFSBenchmark* createAvx2Bencher(const int batchWidth, const std::string& graphLayout, size_t& maxBatchSize, std::string& bfsType) {
+   BFSBenchmark* bencher = nullptr;
+   #ifdef AVX2
+   const int batchType = 256;
+   GEN_BENCH_BRANCH(if,__m256i,4)
+   GEN_BENCH_BRANCH(else if,__m256i,2)
+   GEN_BENCH_BRANCH(else if,__m256i,1)
+   #else
+   (void)batchWidth; (void)graphLayout; (void)maxBatchSize; (void)bfsType;
+   #endif
+   return bencher;
+}
+
+void addAvx2Benchmarks(std::vector<std::unique_ptr<BFSBenchmark>>& benchmarks) {
+   #ifdef AVX2
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,1,true>>("Huge Batch BFS Runner 256 SP    (width 1)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,1,false>>("Huge Batch BFS Runner 256 NoSP  (width 1)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,2,true>>("Huge Batch BFS Runner 256 SP    (width 2)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,2,false>>("Huge Batch BFS Runner 256 NoSp  (width 2)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,4,true>>("Huge Batch BFS Runner 256 SP    (width 4)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,4,false>>("Huge Batch BFS Runner 256 NoSp  (width 4)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,4,false>,Query4::PersonCsrSubgraph>("Huge Batch BFS Runner 256 CSR   (width 4)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,4,false>,Query4::PersonCompressedSubgraph>("Huge Batch BFS Runner 256 VByte (width 4)")));
+   // benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::BatchBFSRunner256>("Batch BFS Runner 256")));
+   #else
+   (void)benchmarks;
+   #endif
+}
+
+}
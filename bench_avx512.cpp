@@ -0,0 +1,32 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "include/dispatch.hpp"
+
+// Compiled with the AVX512 target flags, only called if the host supports them
+
+namespace dispatch {
+
+BFSBenchmark* createAvx512Bencher(const int batchWidth, const std::string& graphLayout, size_t& maxBatchSize, std::string& bfsType) {
+   BFSBenchmark* bencher = nullptr;
+   #ifdef AVX512
+   const int batchType = 512;
+   GEN_BENCH_BRANCH(if,__m512i,4)
+   GEN_BENCH_BRANCH(else if,__m512i,2)
+   GEN_BENCH_BRANCH(else if,__m512i,1)
+   #else
+   (void)batchWidth; (void)graphLayout; (void)maxBatchSize; (void)bfsType;
+   #endif
+   return bencher;
+}
+
+void addAvx512Benchmarks(std::vector<std::unique_ptr<BFSBenchmark>>& benchmarks) {
+   #ifdef AVX512
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m512i,1,false>>("Huge Batch BFS Runner 512 (width 1)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m512i,2,false>>("Huge Batch BFS Runner 512 (width 2)")));
+   #else
+   (void)benchmarks;
+   #endif
+}
+
+}
@@ -0,0 +1,95 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "../include/bfs/batchteam.hpp"
+#include "../include/log.hpp"
+
+#include <cstdlib>
+#include <string>
+
+namespace Query4 {
+
+   BatchTeam::BatchTeam(unsigned size) : job(nullptr), generation(0), numBusy(0), shutdown(false) {
+      assert(size>0);
+      for(unsigned member=1; member<size; member++) {
+         helpers.emplace_back(&BatchTeam::helperLoop, this, member);
+      }
+   }
+
+   BatchTeam::~BatchTeam() {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         shutdown = true;
+      }
+      workCondition.notify_all();
+      for(auto& helper : helpers) {
+         helper.join();
+      }
+   }
+
+   void BatchTeam::helperLoop(unsigned member) {
+      uint64_t seenGeneration = 0;
+      while(true) {
+         const std::function<void(unsigned)>* fn;
+         {
+            std::unique_lock<std::mutex> lock(mutex);
+            workCondition.wait(lock, [&] { return shutdown || generation!=seenGeneration; });
+            if(shutdown) {
+               return;
+            }
+            seenGeneration = generation;
+            fn = job;
+         }
+
+         (*fn)(member);
+
+         std::lock_guard<std::mutex> lock(mutex);
+         if(--numBusy==0) {
+            doneCondition.notify_one();
+         }
+      }
+   }
+
+   void BatchTeam::run(const std::function<void(unsigned)>& fn) {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         job = &fn;
+         numBusy = helpers.size();
+         generation++;
+      }
+      workCondition.notify_all();
+
+      fn(0);
+
+      std::unique_lock<std::mutex> lock(mutex);
+      doneCondition.wait(lock, [&] { return numBusy==0; });
+      job = nullptr;
+   }
+
+   unsigned BatchTeam::teamSize() {
+      static const unsigned size = [] {
+         const char* sizeStr = getenv("BATCH_THREADS");
+         if(sizeStr==nullptr) {
+            return 1u;
+         }
+         const int value = std::stoi(std::string(sizeStr));
+         if(value<1) {
+            FATAL_ERROR("[BatchTeam] Invalid BATCH_THREADS value "<<sizeStr);
+         }
+         return static_cast<unsigned>(value);
+      }();
+      return size;
+   }
+
+   BatchTeam* getThreadLocalBatchTeam() {
+      if(BatchTeam::teamSize()==1) {
+         return nullptr;
+      }
+      // Like the bitset workspace, the team lives as long as the thread
+      static __thread BatchTeam* teamPtr=nullptr;
+      if(teamPtr == nullptr) {
+         teamPtr = new BatchTeam(BatchTeam::teamSize());
+      }
+      return teamPtr;
+   }
+}
@@ -0,0 +1,26 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "../include/bfs/direction.hpp"
+#include "../include/log.hpp"
+
+#include <cstdlib>
+#include <string>
+
+namespace Query4 {
+
+   bool DirectionPolicy::isAdaptive() {
+      static const bool adaptive = [] {
+         const char* policyStr = getenv("DIRECTION_POLICY");
+         if(policyStr==nullptr) {
+            return true;
+         }
+         const std::string policy(policyStr);
+         if(policy!="adaptive" && policy!="static") {
+            FATAL_ERROR("[DirectionPolicy] Invalid DIRECTION_POLICY value "<<policyStr);
+         }
+         return policy=="adaptive";
+      }();
+      return adaptive;
+   }
+}
@@ -134,264 +134,778 @@ __m128i sseMasks[128] = {
    _mm_set_epi32(0x80000000, 0x00000000, 0x00000000, 0x00000000)
 };
 
-#ifdef AVX2
+// The wider masks are plain vector constants, so this file only requires the base architecture
+// while they are used by the kernels compiled for AVX2 and AVX-512
 __m256i sseMasks256[256] = {
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000080),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000400),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000),
-   _mm256_set_epi32(0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000)
+   {0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {(long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull}
 };
 
-#endif
\ No newline at end of file
+__m512i sseMasks512[512] = {
+   {0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {(long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull, 0x0000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000001ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000002ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000004ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000008ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000010ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000020ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000040ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000080ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000100ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000200ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000400ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000800ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000001000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000002000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000004000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000008000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000010000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000020000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000040000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000080000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000100000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000200000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000400000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000800000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000001000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000002000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000004000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000008000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000010000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000020000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000040000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000080000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000100000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000200000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000400000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000800000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000001000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000002000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000004000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000008000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000010000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000020000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000040000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000080000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000100000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000200000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000400000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000800000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0001000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0002000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0004000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0008000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0010000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0020000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0040000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0080000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0100000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0200000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0400000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0800000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x1000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x2000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x4000000000000000ll},
+   {0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, 0x0000000000000000ll, (long long)0x8000000000000000ull}
+};
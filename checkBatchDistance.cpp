@@ -0,0 +1,168 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "include/bfs/batchdistance.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Checks the transposing flush of BatchDistance against the byte extraction it replaced and against a
+// plain count of the visit bits. This file is compiled once per vector extension, CHECK_ISA selects the
+// register types of the object. The object without CHECK_ISA holds main and only calls the others if
+// the host supports them.
+
+namespace {
+
+// Byte counters flushed one extracted byte at a time, byte b of register a counts the bit 8*b+a
+template<typename bit_t, uint64_t width>
+struct ByteExtractDistance {
+   uint32_t* numDistDiscovered;
+   uint8_t localDiscoveredIteration[width];
+   uint8_t localDiscovered[8*width][sizeof(bit_t)];
+
+   ByteExtractDistance(uint32_t* numDistDiscovered) : numDistDiscovered(numDistDiscovered) {
+      memset(localDiscovered, 0, sizeof(localDiscovered));
+      memset(localDiscoveredIteration, 0, width);
+   }
+
+   void updateDiscoveredNodes(const uint64_t partIx) {
+      for(unsigned a=0; a<8; a++) {
+         for(unsigned b=0; b<sizeof(bit_t); b++) {
+            numDistDiscovered[partIx*sizeof(bit_t)*8+8*b+a] += localDiscovered[partIx*8+a][b];
+            localDiscovered[partIx*8+a][b] = 0;
+         }
+      }
+   }
+
+   void updateDiscovered(const bit_t newVisits, const uint64_t partIx) {
+      uint8_t bytes[sizeof(bit_t)];
+      memcpy(bytes, &newVisits, sizeof(bit_t));
+      for(unsigned a=0; a<8; a++) {
+         for(unsigned b=0; b<sizeof(bit_t); b++) {
+            localDiscovered[partIx*8+a][b] += (bytes[b]>>a)&1;
+         }
+      }
+      if(localDiscoveredIteration[partIx]==254) {
+         updateDiscoveredNodes(partIx);
+         localDiscoveredIteration[partIx]=0;
+      } else {
+         localDiscoveredIteration[partIx]++;
+      }
+   }
+
+   void finalize() {
+      for(unsigned i=0; i<width; i++) {
+         updateDiscoveredNodes(i);
+      }
+      memset(localDiscoveredIteration, 0, width);
+   }
+};
+
+// Random visits of the given density in percent, bits are uniformly set
+template<typename bit_t>
+bit_t randomVisits(std::mt19937_64& generator, const unsigned density) {
+   uint8_t bytes[sizeof(bit_t)];
+   for(unsigned b=0; b<sizeof(bit_t); b++) {
+      bytes[b] = 0;
+      for(unsigned bit=0; bit<8; bit++) {
+         if(generator()%100<density) {
+            bytes[b] |= 1<<bit;
+         }
+      }
+   }
+   bit_t visits;
+   memcpy(&visits, bytes, sizeof(bit_t));
+   return visits;
+}
+
+// Runs levels of several densities, every part gets the same number of updates per level
+template<typename bit_t, uint64_t width>
+bool checkDistance(const char* name) {
+   static const uint64_t numSources = sizeof(bit_t)*8*width;
+   // Wraps the byte counters twice, flushes exactly at the 255th update, and only flushes on finalize
+   static const unsigned levelUpdates[] = { 600, 255, 7 };
+   static const unsigned densities[] = { 100, 50, 3 };
+
+   std::mt19937_64 generator(1987);
+   std::vector<uint32_t> counts(numSources, 0);
+   std::vector<uint32_t> referenceCounts(numSources, 0);
+   std::vector<uint32_t> bitCounts(numSources, 0);
+   // On the stack like in the batch BFS, new does not respect the alignment of the registers
+   Query4::BatchDistance<bit_t, width> distance(counts.data());
+   ByteExtractDistance<bit_t, width> reference(referenceCounts.data());
+
+   bool ok=true;
+   for(const unsigned density : densities) {
+      for(const unsigned numUpdates : levelUpdates) {
+         for(unsigned u=0; u<numUpdates*width; u++) {
+            const uint64_t partIx = u%width;
+            const bit_t visits = randomVisits<bit_t>(generator, density);
+            distance.updateDiscovered(visits, partIx);
+            reference.updateDiscovered(visits, partIx);
+            uint8_t bytes[sizeof(bit_t)];
+            memcpy(bytes, &visits, sizeof(bit_t));
+            for(unsigned bit=0; bit<sizeof(bit_t)*8; bit++) {
+               bitCounts[partIx*sizeof(bit_t)*8+bit] += (bytes[bit/8]>>(bit%8))&1;
+            }
+         }
+         distance.finalize();
+         reference.finalize();
+         for(uint64_t source=0; source<numSources; source++) {
+            if(counts[source]!=referenceCounts[source] || counts[source]!=bitCounts[source]) {
+               std::cout<<name<<": source "<<source<<" counted "<<counts[source]<<", byte extraction "<<referenceCounts[source]
+                  <<", visit bits "<<bitCounts[source]<<" (density "<<density<<", "<<numUpdates<<" updates)"<<std::endl;
+               ok=false;
+               break;
+            }
+         }
+         std::fill(counts.begin(), counts.end(), 0);
+         std::fill(referenceCounts.begin(), referenceCounts.end(), 0);
+         std::fill(bitCounts.begin(), bitCounts.end(), 0);
+      }
+   }
+   std::cout<<name<<(ok?" ok":" FAILED")<<std::endl;
+   return ok;
+}
+}
+
+#if !defined(CHECK_ISA)
+bool checkDistanceAvx2();
+bool checkDistanceAvx512();
+
+int main() {
+   bool ok=true;
+   ok &= checkDistance<uint64_t,1>("64x1");
+   ok &= checkDistance<uint64_t,8>("64x8");
+   ok &= checkDistance<__m128i,1>("128x1");
+   ok &= checkDistance<__m128i,8>("128x8");
+   __builtin_cpu_init();
+   if(__builtin_cpu_supports("avx2")) {
+      ok &= checkDistanceAvx2();
+   } else {
+      std::cout<<"256 skipped, the host does not support AVX2"<<std::endl;
+   }
+   if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+      ok &= checkDistanceAvx512();
+   } else {
+      std::cout<<"512 skipped, the host does not support AVX-512"<<std::endl;
+   }
+   return ok ? 0 : 1;
+}
+#elif CHECK_ISA==256
+bool checkDistanceAvx2() {
+   bool ok=true;
+   ok &= checkDistance<__m256i,1>("256x1");
+   ok &= checkDistance<__m256i,4>("256x4");
+   return ok;
+}
+#elif CHECK_ISA==512
+bool checkDistanceAvx512() {
+   bool ok=true;
+   ok &= checkDistance<__m512i,1>("512x1");
+   ok &= checkDistance<__m512i,2>("512x2");
+   return ok;
+}
+#endif
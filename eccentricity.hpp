@@ -0,0 +1,301 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include "query4.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace Query4 {
+
+// Persons whose ids are listed per centre and periphery in the result
+static const size_t maxListedPersons = 10;
+
+struct EccentricityResult {
+   // Radius and centre are those of the largest component
+   uint32_t radius;
+   uint32_t diameter;
+   std::vector<uint64_t> centre;
+   std::vector<uint64_t> periphery;
+   std::vector<uint32_t> eccentricities;
+   uint64_t numBfs;
+
+   std::string toString() const {
+      std::ostringstream output;
+      output<<"radius="<<radius<<" diameter="<<diameter<<" bfs="<<numBfs;
+      output<<" centre="<<centre.size()<<" (";
+      for(size_t i=0; i<centre.size() && i<maxListedPersons; i++) {
+         output<<(i>0?"|":"")<<centre[i];
+      }
+      output<<") periphery="<<periphery.size()<<" (";
+      for(size_t i=0; i<periphery.size() && i<maxListedPersons; i++) {
+         output<<(i>0?"|":"")<<periphery[i];
+      }
+      output<<")";
+      return output.str();
+   }
+};
+
+/// Exact eccentricities of all persons with the bounds of Takes and Kosters: a BFS from s gives every
+/// person v the bounds max(d(s,v), ecc(s)-d(s,v)) <= ecc(v) <= ecc(s)+d(s,v). Each wave runs one batch per
+/// thread of the persons with open bounds, half with the smallest lower and half with the largest upper bound.
+/// A batch yields the eccentricities of its sources and the distance of every person to its farthest source.
+/// The bounds that depend on ecc(s) follow for the whole wave from two BFS over the sources of the wave.
+/// Persons with a single friend never run, their eccentricity is that of the friend plus one.
+template<typename BFSRunnerT, typename GraphT>
+class EccentricityQuery {
+   const GraphT& subgraph;
+   Workers& workers;
+   std::vector<uint32_t> lowerBounds;
+   std::vector<uint32_t> upperBounds;
+   uint64_t numBfs;
+   #ifdef STATISTICS
+   BatchStatistics& statistics;
+   #endif
+
+   static void atomicMax(uint32_t& target, const uint32_t value) {
+      uint32_t current = __atomic_load_n(&target, __ATOMIC_RELAXED);
+      while(value>current && !__atomic_compare_exchange_n(&target, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      }
+   }
+
+   // The last level in which a source discovered persons is its eccentricity, the last round in which
+   // a person is discovered is its distance to the farthest source. A leaf friend of that source is one farther.
+   struct BatchBounds : public LevelAccumulator {
+      EccentricityQuery& query;
+      const BatchBFSdata* const batch;
+      uint32_t* const eccentricities;
+      const std::vector<uint64_t>& leafLanes;
+
+      BatchBounds(EccentricityQuery& query, const std::vector<BatchBFSdata>& batchData, uint32_t* eccentricities, const std::vector<uint64_t>& leafLanes)
+         : query(query), batch(batchData.data()), eccentricities(eccentricities), leafLanes(leafLanes) {
+      }
+
+      void addLevel(BatchBFSdata& bfsData, uint32_t distance, uint32_t /*numDiscovered*/) override {
+         eccentricities[&bfsData-batch] = distance;
+      }
+
+      bool needsVertices() const override {
+         return true;
+      }
+
+      void addVertex(PersonId person, uint32_t round, const uint64_t* lanes) override {
+         for(unsigned w=0; w<leafLanes.size(); w++) {
+            if(lanes[w]&leafLanes[w]) {
+               atomicMax(query.lowerBounds[person], round+1);
+               return;
+            }
+         }
+         atomicMax(query.lowerBounds[person], round);
+      }
+   };
+
+   // The only friend of a leaf is on all its shortest paths, except in components of two persons
+   bool isLeaf(const PersonId person) const {
+      return subgraph.degree(person)==1 && subgraph.componentSizes[subgraph.personComponents[person]]>2;
+   }
+
+   bool hasLeafFriend(const PersonId person) const {
+      auto friendsBounds = subgraph.neighbors(person);
+      for(; friendsBounds.first!=friendsBounds.second; ++friendsBounds.first) {
+         if(isLeaf(*friendsBounds.first)) {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   bool isOpen(const PersonId person) const {
+      return lowerBounds[person]<upperBounds[person];
+   }
+
+   // Persons with open bounds to run next, half with the smallest lower and half with the largest upper bound.
+   // Ties prefer high degrees for the former, whose BFS tightens more upper bounds, and low degrees for the latter.
+   std::vector<PersonId> selectSources(const size_t maxSources) const {
+      std::vector<PersonId> open;
+      for(PersonId person=0; person<subgraph.size(); person++) {
+         if(isOpen(person) && !isLeaf(person)) {
+            open.push_back(person);
+         }
+      }
+      if(open.size()<=maxSources) {
+         return open;
+      }
+      const size_t numCentral = maxSources/2;
+      std::nth_element(open.begin(), open.begin()+numCentral, open.end(), [&](PersonId a, PersonId b) {
+         return lowerBounds[a]!=lowerBounds[b] ? lowerBounds[a]<lowerBounds[b] : subgraph.degree(a)>subgraph.degree(b);
+      });
+      std::nth_element(open.begin()+numCentral, open.begin()+maxSources, open.end(), [&](PersonId a, PersonId b) {
+         return upperBounds[a]!=upperBounds[b] ? upperBounds[a]>upperBounds[b] : subgraph.degree(a)<subgraph.degree(b);
+      });
+      open.resize(maxSources);
+      return open;
+   }
+
+   void runBatch(const PersonId* sources, const size_t numSources, uint32_t* eccentricities) {
+      std::vector<BatchBFSdata> batchData;
+      batchData.reserve(numSources);
+      std::vector<uint64_t> leafLanes((numSources+63)/64, 0);
+      for(size_t i=0; i<numSources; i++) {
+         batchData.push_back(BatchBFSdata(sources[i], subgraph.componentSizes[subgraph.personComponents[sources[i]]]));
+         if(hasLeafFriend(sources[i])) {
+            leafLanes[i/64] |= 1ull<<(i%64);
+         }
+      }
+      BatchBounds batchBounds(*this, batchData, eccentricities, leafLanes);
+      runBatchWithFeed<BFSRunnerT>(batchData, subgraph
+         #ifdef STATISTICS
+         , statistics
+         #endif
+         , nullptr, nullptr, &batchBounds, 0);
+   }
+
+   // BFS in which every source starts at the level of its offset. A person is tightened with the level at which
+   // it is reached first, unless this reaches its limit. Such persons are not expanded either.
+   template<typename LimitT, typename TightenT>
+   void offsetBfs(const std::vector<PersonId>& sources, const std::vector<uint32_t>& offsets, LimitT limit, TightenT tighten) {
+      const uint32_t maxOffset = *std::max_element(offsets.begin(), offsets.end());
+      std::vector<std::vector<PersonId>> startLevels(maxOffset+1);
+      for(size_t i=0; i<sources.size(); i++) {
+         startLevels[offsets[i]].push_back(sources[i]);
+      }
+      std::vector<bool> reached(subgraph.size(), false);
+      std::vector<PersonId> frontier;
+      std::vector<PersonId> next;
+      auto reach = [&](const PersonId person, const uint32_t level) {
+         if(reached[person]) {
+            return;
+         }
+         reached[person] = true;
+         if(level<limit(person)) {
+            tighten(person, level);
+            next.push_back(person);
+         }
+      };
+      for(uint32_t level=0; level<=maxOffset || !frontier.empty(); level++) {
+         next.clear();
+         for(const PersonId person : frontier) {
+            auto friendsBounds = subgraph.neighbors(person);
+            for(; friendsBounds.first!=friendsBounds.second; ++friendsBounds.first) {
+               reach(*friendsBounds.first, level);
+            }
+         }
+         if(level<=maxOffset) {
+            for(const PersonId source : startLevels[level]) {
+               reach(source, level);
+            }
+         }
+         frontier.swap(next);
+      }
+   }
+
+   // min over s of ecc(s)+d(s,v) and max over s of ecc(s)-d(s,v), the latter as maxEccentricity minus the
+   // level with offsets maxEccentricity-ecc(s). Both make the bounds of the sources exact. Upper bounds of
+   // friends differ by at most one, so persons whose bound a level does not tighten end the traversal.
+   void tightenBounds(const std::vector<PersonId>& sources, const std::vector<uint32_t>& eccentricities) {
+      offsetBfs(sources, eccentricities, [&](const PersonId person) {
+         return upperBounds[person];
+      }, [&](const PersonId person, const uint32_t level) {
+         upperBounds[person] = level;
+      });
+      const uint32_t maxEccentricity = *std::max_element(eccentricities.begin(), eccentricities.end());
+      std::vector<uint32_t> offsets(eccentricities.size());
+      for(size_t i=0; i<eccentricities.size(); i++) {
+         offsets[i] = maxEccentricity-eccentricities[i];
+      }
+      offsetBfs(sources, offsets, [&](const PersonId person) {
+         return lowerBounds[person]<maxEccentricity ? maxEccentricity-lowerBounds[person] : 0;
+      }, [&](const PersonId person, const uint32_t level) {
+         lowerBounds[person] = maxEccentricity-level;
+      });
+   }
+
+public:
+   EccentricityQuery(const GraphT& subgraph, Workers& workers
+      #ifdef STATISTICS
+      , BatchStatistics& statistics
+      #endif
+      )
+      : subgraph(subgraph), workers(workers), lowerBounds(subgraph.size(), 0), upperBounds(subgraph.size(), std::numeric_limits<uint32_t>::max()), numBfs(0)
+      #ifdef STATISTICS
+      , statistics(statistics)
+      #endif
+   {
+   }
+
+   EccentricityResult run() {
+      const size_t batchSize = BFSRunnerT::batchSize();
+      const size_t waveSize = batchSize*(workers.threads.size()+1);
+      while(true) {
+         const std::vector<PersonId> sources = selectSources(waveSize);
+         if(sources.empty()) {
+            break;
+         }
+         std::vector<uint32_t> eccentricities(sources.size(), 0);
+         const size_t numBatches = (sources.size()+batchSize-1)/batchSize;
+         workers.runRanges(numBatches, [&](size_t begin, size_t end) {
+            for(size_t b=begin; b<end; b++) {
+               const size_t first = b*batchSize;
+               runBatch(sources.data()+first, std::min(batchSize, sources.size()-first), eccentricities.data()+first);
+            }
+         });
+         tightenBounds(sources, eccentricities);
+         numBfs += sources.size();
+         LOG_PRINT("[Eccentricity] Wave of "<< sources.size() <<" sources finished");
+      }
+      for(PersonId person=0; person<subgraph.size(); person++) {
+         if(isLeaf(person)) {
+            lowerBounds[person] = lowerBounds[*subgraph.neighbors(person).first]+1;
+         }
+      }
+
+      EccentricityResult result;
+      result.numBfs = numBfs;
+      result.eccentricities = lowerBounds;
+      result.diameter = 0;
+      result.radius = std::numeric_limits<uint32_t>::max();
+      auto inLargestComponent = [&](const PersonId person) {
+         return subgraph.componentSizes[subgraph.personComponents[person]]==subgraph.maxComponentSize;
+      };
+      for(PersonId person=0; person<subgraph.size(); person++) {
+         result.diameter = std::max(result.diameter, lowerBounds[person]);
+         if(inLargestComponent(person)) {
+            result.radius = std::min(result.radius, lowerBounds[person]);
+         }
+      }
+      for(PersonId person=0; person<subgraph.size(); person++) {
+         if(inLargestComponent(person) && lowerBounds[person]==result.radius) {
+            result.centre.push_back(subgraph.mapInternalNodeId(person));
+         }
+         if(lowerBounds[person]==result.diameter) {
+            result.periphery.push_back(subgraph.mapInternalNodeId(person));
+         }
+      }
+      std::sort(result.centre.begin(), result.centre.end());
+      std::sort(result.periphery.begin(), result.periphery.end());
+      return result;
+   }
+};
+
+/// Runs the eccentricity query, the result lists radius, diameter, centre and periphery
+template<typename BFSRunnerT, typename GraphT>
+std::string runEccentricity(const GraphT& subgraph, Workers& workers, uint64_t& runtimeOut
+   #ifdef STATISTICS
+   , BatchStatistics& statistics
+   #endif
+   ) {
+   const auto start = tschrono::now();
+   EccentricityQuery<BFSRunnerT, GraphT> query(subgraph, workers
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      );
+   const EccentricityResult result = query.run();
+   runtimeOut = tschrono::now() - start;
+   return result.toString();
+}
+}
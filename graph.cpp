@@ -4,78 +4,242 @@
 #include "include/tokenizer.hpp"
 #include "include/graph.hpp"
 #include "include/io.hpp"
+#include "include/worker.hpp"
+#include "include/radixsort.hpp"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <sys/mman.h>
 
 using namespace std;
 
-GraphData GraphData::loadFromPath(const std::string& edgesFile) {
-   // Count number of persons (excluding header line)
-   size_t numEdges = io::fileLines(edgesFile)-1;
-   LOG_PRINT("[LOADING] Number of edges: "<<numEdges);
+// Parses the edges of all lines in [begin, end)
+static void parseEdges(uint8_t* begin, uint8_t* end, vector<NodePair>& edges) {
+   Tokenizer tokenizer(begin, end-begin);
+   while(!tokenizer.isFinished()) {
+      NodePair pair;
+      pair.idA = tokenizer.readId('|');
+      pair.idB = tokenizer.readId('\n');
+      if(pair.idA == pair.idB) {
+         continue; //No self-edges
+      }
 
+      edges.push_back(pair);
+   }
+}
 
+GraphData GraphData::loadFromPath(const std::string& edgesFile, Workers& workers) {
    // Load edges data from file
    LOG_PRINT("[LOADING] Loading edges from file: "<< edgesFile);
    io::MmapedFile file(edgesFile, O_RDONLY);
+   madvise(file.mapping, file.size, MADV_SEQUENTIAL|MADV_WILLNEED);
 
+   uint8_t* data = reinterpret_cast<uint8_t*>(file.mapping);
+   uint8_t* const dataEnd = data+file.size;
    Tokenizer tokenizer(file.mapping, file.size);
    tokenizer.skipLine(); // Skip header line
 
-   vector<NodePair> edges;
-   edges.reserve(numEdges);
-
-   std::unordered_map<uint64_t,uint64_t> nodeRenaming;
-   std::unordered_map<uint64_t,uint64_t> revNodeRenaming;
-   uint64_t nextNodeId=0;
-
-   auto mapExternalNodeId = [&nodeRenaming, &revNodeRenaming, &nextNodeId](uint64_t id) -> uint64_t {
-      if(nodeRenaming.find(id)==nodeRenaming.end()) {
-         nodeRenaming[id] = nextNodeId;
-         revNodeRenaming[nextNodeId] = id;
-         return nextNodeId++;
+   // Split file into chunks at line boundaries, use more chunks than threads for load balancing
+   const size_t numChunks = (workers.threads.size()+1)*4;
+   const size_t chunkSize = (dataEnd-tokenizer.iter)/numChunks+1;
+   vector<uint8_t*> chunkBounds;
+   chunkBounds.push_back(tokenizer.iter);
+   while(chunkBounds.back()!=dataEnd) {
+      uint8_t* bound;
+      if(static_cast<size_t>(dataEnd-chunkBounds.back())<=chunkSize) {
+         bound = dataEnd;
       } else {
-         return nodeRenaming[id];
+         bound = chunkBounds.back()+chunkSize;
+         bound = reinterpret_cast<uint8_t*>(memchr(bound, '\n', dataEnd-bound));
+         bound = bound==nullptr ? dataEnd : bound+1;
       }
-   };
+      chunkBounds.push_back(bound);
+   }
 
-   while(!tokenizer.isFinished()) {
-      assert(edges.size()<numEdges*2);
-      NodePair pair;
-      pair.idA = tokenizer.readId('|');
-      pair.idB = tokenizer.readId('\n');
-      if(pair.idA == pair.idB) {
-         continue; //No self-edges
-      }
+   // Parse chunks in parallel into thread local edge buffers
+   vector<vector<NodePair>> chunkEdges(chunkBounds.size()-1);
+   vector<Task> parseTasks;
+   for(size_t c=0; c<chunkEdges.size(); c++) {
+      parseTasks.push_back(LambdaRunner::createLambdaTask([&chunkBounds, &chunkEdges, c] {
+         parseEdges(chunkBounds[c], chunkBounds[c+1], chunkEdges[c]);
+      }));
+   }
+   workers.runAll(move(parseTasks));
 
-      //Add undirected
-      edges.push_back(pair);
-      edges.push_back(NodePair(pair.idB, pair.idA));
-   }
-
-   // Reading edges
-   LOG_PRINT("[LOADING] Read edges");
-   std::sort(edges.begin(), edges.end(), [](const NodePair& a, const NodePair& b) {
-      return a.idA<b.idA||(a.idA==b.idA && a.idB<b.idB);
-   });
-
-   //Remove duplicates
-   vector<NodePair> uniqueEdges(edges.size());
-   size_t e=0;
-   NodePair last(numeric_limits<uint64_t>::max(), numeric_limits<uint64_t>::max());
-   for(const NodePair& a : edges) {
-      if(last.idA!=a.idA || last.idB!=a.idB) {
-         last = a;
-         uniqueEdges[e++] = NodePair(mapExternalNodeId(a.idA), a.idB);
+   size_t numEdges=0;
+   for(const auto& chunk : chunkEdges) {
+      numEdges += chunk.size();
+   }
+   LOG_PRINT("[LOADING] Number of edges: "<<numEdges);
+
+   vector<uint64_t> revNodeRenaming = renameNodes(chunkEdges, workers);
+   const size_t numNodes = revNodeRenaming.size();
+   LOG_PRINT("[LOADING] Number of nodes: "<<numNodes);
+
+   return GraphData(numNodes, move(chunkEdges), move(revNodeRenaming));
+}
+
+vector<uint64_t> GraphData::renameNodes(vector<vector<NodePair>>& edgeChunks, Workers& workers) {
+   // Sort and unique the ids of each chunk locally so the global id list stays small
+   vector<vector<uint64_t>> chunkIds(edgeChunks.size());
+   vector<Task> collectTasks;
+   for(size_t c=0; c<edgeChunks.size(); c++) {
+      collectTasks.push_back(LambdaRunner::createLambdaTask([&edgeChunks, &chunkIds, c] {
+         vector<uint64_t> ids;
+         ids.reserve(edgeChunks[c].size()*2);
+         for(const NodePair& edge : edgeChunks[c]) {
+            ids.push_back(edge.idA);
+            ids.push_back(edge.idB);
+         }
+         sort(ids.begin(), ids.end());
+         chunkIds[c].assign(ids.begin(), unique(ids.begin(), ids.end()));
+      }));
+   }
+   workers.runAll(move(collectTasks));
+
+   // Sorted unique external ids, the position in this list is the dense id
+   vector<uint64_t> revNodeRenaming;
+   for(auto& ids : chunkIds) {
+      revNodeRenaming.insert(revNodeRenaming.end(), ids.begin(), ids.end());
+      vector<uint64_t>().swap(ids);
+   }
+   radix::sortUnique(revNodeRenaming, workers);
+   revNodeRenaming.shrink_to_fit();
+
+   // Map both endpoints to their dense id
+   vector<Task> mapTasks;
+   for(size_t c=0; c<edgeChunks.size(); c++) {
+      mapTasks.push_back(LambdaRunner::createLambdaTask([&edgeChunks, &revNodeRenaming, c] {
+         for(NodePair& edge : edgeChunks[c]) {
+            const auto posA = lower_bound(revNodeRenaming.begin(), revNodeRenaming.end(), edge.idA);
+            const auto posB = lower_bound(revNodeRenaming.begin(), revNodeRenaming.end(), edge.idB);
+            assert(posA!=revNodeRenaming.end() && *posA==edge.idA);
+            assert(posB!=revNodeRenaming.end() && *posB==edge.idB);
+            edge.idA = posA-revNodeRenaming.begin();
+            edge.idB = posB-revNodeRenaming.begin();
+         }
+      }));
+   }
+   workers.runAll(move(mapTasks));
+
+   return revNodeRenaming;
+}
+
+const char GraphSnapshotHeader::magicValue[8] = {'M','S','B','F','S','G','R','\0'};
+
+bool GraphSnapshotHeader::isSnapshot(const void* mapping, size_t size) {
+   return size>=sizeof(GraphSnapshotHeader) && memcmp(mapping, magicValue, sizeof(magicValue))==0;
+}
+
+std::string GraphSnapshotHeader::cachePath(const std::string& edgesFile) {
+   return edgesFile+".snapshot";
+}
+
+bool GraphSnapshotHeader::hasValidCache(const std::string& edgesFile) {
+   struct stat edgesStat, cacheStat;
+   if(stat(cachePath(edgesFile).c_str(), &cacheStat)!=0 || stat(edgesFile.c_str(), &edgesStat)!=0) {
+      return false;
+   }
+   if(cacheStat.st_mtime<edgesStat.st_mtime) {
+      return false;
+   }
+   io::MmapedFile file(cachePath(edgesFile), O_RDONLY);
+   if(!isSnapshot(file.mapping, file.size)) {
+      return false;
+   }
+   const GraphSnapshotHeader& header = *reinterpret_cast<const GraphSnapshotHeader*>(file.mapping);
+   if(header.version!=currentVersion) {
+      LOG_PRINT("[LOADING] Ignoring graph snapshot of version "<<header.version);
+      return false;
+   }
+   const std::string relabeling = relabelingNameFromEnv();
+   if(strncmp(header.relabeling, relabeling.c_str(), sizeof(header.relabeling))!=0) {
+      LOG_PRINT("[LOADING] Ignoring graph snapshot relabeled by "<<std::string(header.relabeling, strnlen(header.relabeling, sizeof(header.relabeling)))<<", expected "<<relabeling);
+      return false;
+   }
+   return true;
+}
+
+void GraphSnapshotHeader::validate(size_t fileSize, size_t expectedIdSize) const {
+   if(!isSnapshot(this, fileSize)) {
+      FATAL_ERROR("[LOADING] Not a graph snapshot");
+   }
+   if(version!=currentVersion) {
+      FATAL_ERROR("[LOADING] Unsupported graph snapshot version "<<version<<", expected "<<currentVersion);
+   }
+   if(idSize!=expectedIdSize) {
+      FATAL_ERROR("[LOADING] Graph snapshot id size "<<idSize<<" does not match "<<expectedIdSize);
+   }
+   typedef Graph<uint32_t>::ComponentId ComponentId;
+   typedef Graph<uint32_t>::ComponentSize ComponentSize;
+   if(!sectionFits(offsetsPos, numVertices, sizeof(uint64_t), fileSize)
+      || !sectionFits(dataPos, dataSize, 1, fileSize)
+      || !sectionFits(componentsPos, numVertices, sizeof(ComponentId), fileSize)
+      || !sectionFits(componentSizesPos, numComponents, sizeof(ComponentSize), fileSize)
+      || !sectionFits(componentEdgeCountPos, numComponents, sizeof(ComponentSize), fileSize)
+      || !sectionFits(renamingPos, numVertices, sizeof(uint64_t), fileSize)) {
+      FATAL_ERROR("[LOADING] Graph snapshot is truncated");
+   }
+
+   // Every adjacency list including its size has to be inside the data section
+   const uint8_t* base = reinterpret_cast<const uint8_t*>(this);
+   const uint64_t* offsets = reinterpret_cast<const uint64_t*>(base+offsetsPos);
+   const uint64_t numEntries = dataSize/idSize;
+   for(uint64_t vertex=0; vertex<numVertices; vertex++) {
+      const uint64_t offset = offsets[vertex];
+      uint64_t count = 0;
+      if(offset<numEntries) {
+         memcpy(&count, base+dataPos+offset*idSize, idSize);
+      }
+      if(offset>=numEntries || count>numEntries-offset-1) {
+         FATAL_ERROR("[LOADING] Graph snapshot is truncated, adjacency list of vertex "<<vertex<<" exceeds the data section");
       }
    }
-   uniqueEdges.resize(e);
-   for(NodePair& a : uniqueEdges) {
-      a.idB = mapExternalNodeId(a.idB);
+}
+
+bool GraphSnapshotHeader::sectionFits(uint64_t pos, uint64_t count, uint64_t elementSize, size_t fileSize) {
+   return pos<=fileSize && count<=(fileSize-pos)/elementSize;
+}
+
+GraphSnapshotWriter::GraphSnapshotWriter(const std::string& path) : fd(-1), pos(sizeof(GraphSnapshotHeader)), path(path), header() {
+   memcpy(header.magic, GraphSnapshotHeader::magicValue, sizeof(header.magic));
+   header.version = GraphSnapshotHeader::currentVersion;
+   // Write to a temporary file so a concurrent reader never sees a partial snapshot
+   fd = ::open((path+".tmp").c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644);
+   if(fd<0) { FATAL_ERROR("[LOADING] Could not create graph snapshot "<<path); }
+}
+
+GraphSnapshotWriter::~GraphSnapshotWriter() {
+   if(fd!=-1) {
+      ::close(fd);
+      unlink((path+".tmp").c_str());
    }
-   LOG_PRINT("[LOADING] Sorted edges");
+}
 
-   LOG_PRINT("[LOADING] Number of nodes: "<<nextNodeId);
+uint64_t GraphSnapshotWriter::writeSection(const void* data, size_t size) {
+   static const uint64_t alignment = 64;
+   pos = (pos+alignment-1)/alignment*alignment;
+   const uint64_t sectionPos = pos;
+   const char* ptr = reinterpret_cast<const char*>(data);
+   while(size>0) {
+      const ssize_t written = pwrite(fd, ptr, size, pos);
+      if(written<=0) { FATAL_ERROR("[LOADING] Could not write graph snapshot "<<path); }
+      ptr += written;
+      pos += written;
+      size -= written;
+   }
+   return sectionPos;
+}
 
-   return GraphData(nextNodeId, move(uniqueEdges), move(revNodeRenaming));
+void GraphSnapshotWriter::finish() {
+   if(pwrite(fd, &header, sizeof(GraphSnapshotHeader), 0)!=sizeof(GraphSnapshotHeader)) {
+      FATAL_ERROR("[LOADING] Could not write graph snapshot header "<<path);
+   }
+   ::close(fd);
+   fd = -1;
+   if(rename((path+".tmp").c_str(), path.c_str())!=0) {
+      FATAL_ERROR("[LOADING] Could not move graph snapshot to "<<path);
+   }
 }
@@ -59,20 +59,25 @@ public:
       this->bfsType = bfsType;
    }
 
+   // Rounds past maxRounds are counted in the last slot, batches with refilled lanes run that long
+   static size_t slot(size_t round) {
+      return round<maxRounds ? round : maxRounds-1;
+   }
+
    void traceRound(size_t round) {
-      numRounds[round]++;
+      numRounds[slot(round)]++;
    }
 
    void addRoundDuration(size_t round, size_t duration) {
-      roundDurations[round] += duration;
+      roundDurations[slot(round)] += duration;
    }
 
    void addRoundVisitBits(size_t round, size_t visitBits, size_t count) {
-      roundVisitBits[round][visitBits]+=count;
+      roundVisitBits[slot(round)][visitBits]+=count;
    }
 
    void addRoundFriendBits(size_t round, size_t friendBits, size_t count) {
-      roundFriendBits[round][friendBits]+=count;
+      roundFriendBits[slot(round)][friendBits]+=count;
    }
 
    void setNumTraversedEdges(size_t c) {
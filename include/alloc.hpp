@@ -0,0 +1,59 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// Allocation of large, long lived arrays such as graph data and BFS bitsets.
+/// The page and placement policy is configured at runtime:
+///   HUGE_PAGES=off|thp|hugetlb   thp advises transparent huge pages, hugetlb maps from the
+///                                reserved huge page pool and falls back to thp if it is empty
+///   NUMA_POLICY=firsttouch|interleave   interleave spreads pages over all online nodes,
+///                                firsttouch leaves placement to the first thread writing a page
+namespace mem {
+   /// Returns zeroed memory aligned to at least 64 bytes. Out of memory is a FATAL_ERROR for both
+   /// the heap and the mapped allocations, it prints the requested size and throws -1.
+   void* allocate(size_t size);
+   /// Releases memory of allocate(), size has to match the allocated size
+   void release(void* ptr, size_t size);
+
+   template<typename T>
+   T* allocateArray(size_t count) {
+      return static_cast<T*>(allocate(count*sizeof(T)));
+   }
+
+   template<typename T>
+   void releaseArray(T* ptr, size_t count) {
+      release(ptr, count*sizeof(T));
+   }
+
+   /// Standard allocator on top of the allocation layer
+   template<typename T>
+   struct Allocator {
+      typedef T value_type;
+
+      Allocator() { }
+      template<typename U>
+      Allocator(const Allocator<U>&) { }
+
+      T* allocate(size_t count) {
+         return allocateArray<T>(count);
+      }
+
+      void deallocate(T* ptr, size_t count) {
+         releaseArray(ptr, count);
+      }
+
+      template<typename U>
+      struct rebind {
+         typedef Allocator<U> other;
+      };
+   };
+
+   template<typename T, typename U>
+   bool operator==(const Allocator<T>&, const Allocator<U>&) { return true; }
+   template<typename T, typename U>
+   bool operator!=(const Allocator<T>&, const Allocator<U>&) { return false; }
+}
@@ -1,9 +1,13 @@
 //Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
 //
 //Code must not be used, distributed, without written consent by the authors
+#pragma once
+
 #include "tokenizer.hpp"
 #include "graph.hpp"
 #include "../query4.hpp"
+#include "../eccentricity.hpp"
+#include "../sampledcloseness.hpp"
 #include "bfs/noqueue.hpp"
 #include "bfs/sc2012.hpp"
 #include "io.hpp"
@@ -64,6 +68,9 @@ struct BFSBenchmark {
       return sum / runtimes.size();
    }
 
+   /// Called once per loaded graph before the runs, e.g., to convert it into another layout
+   virtual void prepare(const Query4::PersonSubgraph& subgraph) = 0;
+
    virtual void run(const uint32_t k, const Query4::PersonSubgraph& subgraph, const string& referenceResult, Workers& workers, uint64_t maxBfs) = 0;
 
    virtual size_t batchSize() = 0;
@@ -73,7 +80,33 @@ struct BFSBenchmark {
    virtual std::string getMinTrace() = 0;
 };
 
-template<typename BFSRunnerT>
+/// Holds the graph in the adjacency layout a benchmark runs on
+template<typename GraphT>
+struct LayoutGraph {
+   std::unique_ptr<GraphT> graph;
+
+   void prepare(const Query4::PersonSubgraph& subgraph) {
+      graph.reset();
+      graph.reset(new GraphT(subgraph));
+   }
+
+   const GraphT& get(const Query4::PersonSubgraph& /*subgraph*/) const {
+      assert(graph);
+      return *graph;
+   }
+};
+
+template<>
+struct LayoutGraph<Query4::PersonSubgraph> {
+   void prepare(const Query4::PersonSubgraph& /*subgraph*/) {
+   }
+
+   const Query4::PersonSubgraph& get(const Query4::PersonSubgraph& subgraph) const {
+      return subgraph;
+   }
+};
+
+template<typename BFSRunnerT, typename GraphT=Query4::PersonSubgraph>
 struct SpecializedBFSBenchmark : public BFSBenchmark {
    #ifdef STATISTICS
    Query4::BatchStatistics statistics;
@@ -81,19 +114,50 @@ struct SpecializedBFSBenchmark : public BFSBenchmark {
 
    std::vector<std::string> traces;
 
+   LayoutGraph<GraphT> layoutGraph;
+
    typedef TraceStats<BFSRunnerT::TYPE_BITS*BFSRunnerT::WIDTH> RunnerTraceStats;
 
    SpecializedBFSBenchmark(std::string name)
       : BFSBenchmark(name)
    { }
+   virtual void prepare(const Query4::PersonSubgraph& subgraph) override {
+      layoutGraph.prepare(subgraph);
+   }
+
    virtual void run(const uint32_t k, const Query4::PersonSubgraph& subgraph, const string& referenceResult, Workers& workers, uint64_t maxBfs) override {
       uint64_t runtime;
-      std::string result = runBFS<BFSRunnerT>(k, subgraph, workers, maxBfs, runtime
+      if(Query4::getQueryType()!=Query4::QueryType::Centrality) {
+         // Neither query has a reference result
+         if(Query4::getQueryType()==Query4::QueryType::Eccentricity) {
+            std::string result = Query4::runEccentricity<BFSRunnerT>(layoutGraph.get(subgraph), workers, runtime
+               #ifdef STATISTICS
+               ,statistics
+               #endif
+               );
+            cout<<"# Eccentricity "<<result<<endl;
+         } else {
+            std::string result = Query4::runSampledCloseness<BFSRunnerT>(k, layoutGraph.get(subgraph), workers, runtime
+               #ifdef STATISTICS
+               ,statistics
+               #endif
+               );
+            cout<<"# Sampled closeness "<<result<<endl;
+         }
+         runtimes.push_back(runtime);
+         traces.push_back(RunnerTraceStats::getStats().print(runtime));
+         return;
+      }
+      std::string result = runBFS<BFSRunnerT>(k, layoutGraph.get(subgraph), workers, maxBfs, runtime
       #ifdef STATISTICS
          ,statistics
          #endif
          );
-      if(maxBfs == std::numeric_limits<uint64_t>::max() && result != referenceResult) {
+      // Only closeness runs over all persons have the reference result, other rankings are printed
+      const auto& metrics = Query4::getCentralityMetrics();
+      if(metrics.size()!=1 || metrics.front()!=Query4::CentralityMetric::Closeness) {
+         cout<<"# Centrality "<<result<<endl;
+      } else if(maxBfs>=subgraph.size() && result != referenceResult) {
          cout<<endl;
          FATAL_ERROR("[Query] Wrong result, expected ["<<referenceResult<<"], got ["<<result<<"]");
       }
@@ -124,3 +188,25 @@ struct SpecializedBFSBenchmark : public BFSBenchmark {
       return traces[minRuntimeIx];
    }
 };
+
+// Creates the benchmark for the adjacency layout given by GRAPH_LAYOUT: sizedlist (default), csr or compressed
+template<typename BFSRunnerT>
+BFSBenchmark* createLayoutBencher(const std::string& name, const std::string& suffix, const std::string& graphLayout) {
+   if(graphLayout=="csr") {
+      return new SpecializedBFSBenchmark<BFSRunnerT,Query4::PersonCsrSubgraph>(name+" CSR"+suffix);
+   } else if(graphLayout=="compressed") {
+      return new SpecializedBFSBenchmark<BFSRunnerT,Query4::PersonCompressedSubgraph>(name+" VByte"+suffix);
+   } else if(graphLayout=="sizedlist") {
+      return new SpecializedBFSBenchmark<BFSRunnerT>(name+suffix);
+   } else {
+      FATAL_ERROR("[Main] Unknown graph layout "<<graphLayout);
+   }
+}
+
+#define GEN_BENCH_BRANCH(X,CTYPE,WIDTH) \
+   X(batchType==sizeof(CTYPE)*8&&batchWidth==WIDTH) { \
+      bencher = createLayoutBencher<Query4::HugeBatchBfs<CTYPE,WIDTH,false>>("BatchBFS "+std::to_string(sizeof(CTYPE)*8), " ("+std::to_string(WIDTH)+")", graphLayout); \
+      maxBatchSize = sizeof(CTYPE)*8*WIDTH; \
+      bfsType = std::to_string(sizeof(CTYPE)*8)+"_"+std::to_string(WIDTH); \
+   } \
+
@@ -5,7 +5,11 @@
 
 #include "../queue.hpp"
 #include "../graph.hpp"
+#include "../alloc.hpp"
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 
 namespace Query4 {
    typedef uint64_t Distances; // Type for the sum of distances
@@ -14,6 +18,8 @@ namespace Query4 {
    typedef PersonId Persons; // Type for counting persons
 
    typedef Graph<PersonId> PersonSubgraph;
+   typedef CsrGraph<PersonId> PersonCsrSubgraph;
+   typedef CompressedGraph<PersonId> PersonCompressedSubgraph;
 
    inline awfy::FixedSizeQueue<PersonId>& getThreadLocalPersonVisitQueue(size_t queueSize) {
       static __thread awfy::FixedSizeQueue<PersonId>* toVisitPtr=nullptr;
@@ -28,16 +34,245 @@ namespace Query4 {
       }
    }
 
+   /// Smallest vertex range containing all vertices whose bitsets were written
+   struct TouchedRange {
+      PersonId begin;
+      PersonId end;
+
+      TouchedRange() {
+         reset();
+      }
+
+      void add(const PersonId person) {
+         begin = std::min(begin, person);
+         end = std::max(end, person+1);
+      }
+
+      bool empty() const {
+         return begin >= end;
+      }
+
+      void reset() {
+         begin = std::numeric_limits<PersonId>::max();
+         end = 0;
+      }
+   };
+
+   /// One bit per vertex and a second level bit per 64 vertices that is set if any of them is.
+   /// Scans jump over empty words with ctz instead of loading the bitsets of inactive vertices.
+   /// Bits of vertices that became inactive may stay set, a summary is only used while valid.
+   class VertexSummary {
+      uint64_t* words;
+      uint64_t* groups;
+      size_t capacity; // Words
+      // Groups that may have bits set, clearing only zeroes these
+      size_t firstGroup;
+      size_t endGroup;
+
+      static size_t numGroups(size_t n) {
+         return (n+63)/64;
+      }
+
+      void markWord(const size_t w) {
+         groups[w>>6] |= 1ull<<(w&63);
+         firstGroup = std::min(firstGroup, w>>6);
+         endGroup = std::max(endGroup, (w>>6)+1);
+      }
+
+   public:
+      bool valid;
+
+      VertexSummary() : words(nullptr), groups(nullptr), capacity(0), firstGroup(std::numeric_limits<size_t>::max()), endGroup(0), valid(false) {
+      }
+
+      VertexSummary(const VertexSummary&) = delete;
+      VertexSummary& operator=(const VertexSummary&) = delete;
+
+      ~VertexSummary() {
+         mem::releaseArray(words, capacity);
+         mem::releaseArray(groups, numGroups(capacity));
+      }
+
+      /// Provides an empty, invalid summary of numVertices vertices
+      void resize(size_t numVertices) {
+         const size_t required = (numVertices+63)/64;
+         if(required > capacity) {
+            mem::releaseArray(words, capacity);
+            mem::releaseArray(groups, numGroups(capacity));
+            words = mem::allocateArray<uint64_t>(required);
+            groups = mem::allocateArray<uint64_t>(numGroups(required));
+            capacity = required;
+            firstGroup = std::numeric_limits<size_t>::max();
+            endGroup = 0;
+         }
+         clear();
+         valid = false;
+      }
+
+      /// Removes all vertices
+      void clear() {
+         if(firstGroup<endGroup) {
+            const size_t endWord = std::min(endGroup*64, capacity);
+            memset(words+firstGroup*64, 0, (endWord-firstGroup*64)*sizeof(uint64_t));
+            memset(groups+firstGroup, 0, (endGroup-firstGroup)*sizeof(uint64_t));
+         }
+         firstGroup = std::numeric_limits<size_t>::max();
+         endGroup = 0;
+      }
+
+      void set(const PersonId person) {
+         words[person>>6] |= 1ull<<(person&63);
+         markWord(person>>6);
+      }
+
+      void unset(const PersonId person) {
+         words[person>>6] &= ~(1ull<<(person&63));
+      }
+
+      /// Replaces the vertices of word w
+      void store(const size_t w, const uint64_t bits) {
+         words[w] = bits;
+         if(bits!=0) {
+            markWord(w);
+         }
+      }
+
+      /// First word from w on that may have vertices, every word if the summary is not valid
+      size_t nextWord(size_t w, const size_t endWord) const {
+         if(!valid) {
+            return w;
+         }
+         while(w<endWord) {
+            const uint64_t groupBits = groups[w>>6] & (~0ull<<(w&63));
+            if(groupBits!=0) {
+               return std::min<size_t>((w&~63ull)+__builtin_ctzl(groupBits), endWord);
+            }
+            w = (w|63)+1;
+         }
+         return endWord;
+      }
+
+      /// Vertices of word w within [begin,end), all of them if the summary is not valid
+      uint64_t candidates(const size_t w, const PersonId begin, const PersonId end) const {
+         uint64_t bits = valid ? words[w] : ~0ull;
+         if(w==(begin>>6)) {
+            bits &= ~0ull<<(begin&63);
+         }
+         if(w==(end>>6)) {
+            bits &= ~(~0ull<<(end&63));
+         }
+         return bits;
+      }
+   };
+
+   /// Bitset arrays of a batch BFS that are kept alive across batches. Instead of zeroing
+   /// the whole arrays, only the range touched by the previous batch is cleared.
+   class BitsetWorkspace {
+   public:
+      static const unsigned NUM_ARRAYS = 3;
+
+   private:
+      uint8_t* arrays[NUM_ARRAYS];
+      size_t capacity; // Bytes per array
+      size_t bitsetSize; // Bytes per vertex of the previous batch
+      PersonId* frontierIds[2]; // Not cleared between batches
+      size_t frontierCapacity;
+
+   public:
+      TouchedRange touched;
+      // Vertices with visit bits in the two visit arrays, and vertices that are missing active sources
+      VertexSummary summaries[2];
+      VertexSummary pending;
+
+      BitsetWorkspace() : arrays(), capacity(0), bitsetSize(0), frontierIds(), frontierCapacity(0) {
+      }
+
+      BitsetWorkspace(const BitsetWorkspace&) = delete;
+      BitsetWorkspace& operator=(const BitsetWorkspace&) = delete;
+
+      ~BitsetWorkspace() {
+         for(unsigned a=0; a<NUM_ARRAYS; a++) {
+            mem::release(arrays[a], capacity);
+         }
+         for(unsigned a=0; a<2; a++) {
+            mem::releaseArray(frontierIds[a], frontierCapacity);
+         }
+      }
+
+      /// Provides all-zero arrays of numBitsets entries of size newBitsetSize
+      void reset(size_t numBitsets, size_t newBitsetSize) {
+         const size_t required = numBitsets*newBitsetSize;
+         if(required > capacity) {
+            for(unsigned a=0; a<NUM_ARRAYS; a++) {
+               mem::release(arrays[a], capacity);
+               arrays[a] = static_cast<uint8_t*>(mem::allocate(required));
+            }
+            capacity = required;
+         } else if(!touched.empty()) {
+            const size_t offset = size_t(touched.begin)*bitsetSize;
+            const size_t length = size_t(touched.end-touched.begin)*bitsetSize;
+            for(unsigned a=0; a<NUM_ARRAYS; a++) {
+               memset(arrays[a]+offset, 0, length);
+            }
+         }
+         if(numBitsets > frontierCapacity) {
+            for(unsigned a=0; a<2; a++) {
+               mem::releaseArray(frontierIds[a], frontierCapacity);
+               frontierIds[a] = mem::allocateArray<PersonId>(numBitsets);
+            }
+            frontierCapacity = numBitsets;
+         }
+         for(unsigned a=0; a<2; a++) {
+            summaries[a].resize(numBitsets);
+         }
+         pending.resize(numBitsets);
+         bitsetSize = newBitsetSize;
+         touched.reset();
+      }
+
+      template<typename Bitset>
+      Bitset* get(unsigned a) {
+         assert(a<NUM_ARRAYS && sizeof(Bitset)==bitsetSize);
+         return reinterpret_cast<Bitset*>(arrays[a]);
+      }
+
+      /// Room for one id per vertex
+      PersonId* getFrontierIds(unsigned a) {
+         assert(a<2);
+         return frontierIds[a];
+      }
+   };
+
+   /// Number of batches a thread can run at the same time
+   static const unsigned MAX_THREAD_WORKSPACES = 4;
+
+   /// Shared by all batch BFS variants running on the calling thread, interleaved batches use different slots
+   inline BitsetWorkspace& getThreadLocalBitsetWorkspace(size_t numBitsets, size_t bitsetSize, unsigned slot=0) {
+      static __thread BitsetWorkspace* workspacePtrs[MAX_THREAD_WORKSPACES]={};
+      assert(slot<MAX_THREAD_WORKSPACES);
+      if(workspacePtrs[slot] == nullptr) {
+         workspacePtrs[slot] = new BitsetWorkspace();
+      }
+      workspacePtrs[slot]->reset(numBitsets, bitsetSize);
+      return *workspacePtrs[slot];
+   }
+
    struct BatchBFSdata {
+      static const unsigned NUM_LEVEL_SUMS = 2;
+
       const PersonId person;
       const Persons componentSize;
 
       Distances totalDistances;
       Persons totalReachable;
+      // The BFS was stopped before it finished, the totals are incomplete
+      bool pruned;
+      // Sums of a LevelAccumulator over the BFS levels
+      double levelSums[NUM_LEVEL_SUMS];
 
       BatchBFSdata(PersonId person, Persons componentSize)
          : person(person), componentSize(componentSize),
-           totalDistances(0),totalReachable(0)
+           totalDistances(0),totalReachable(0),pruned(false),levelSums()
       { }
 
       BatchBFSdata(const BatchBFSdata&) = delete;
@@ -45,7 +280,48 @@ namespace Query4 {
 
       BatchBFSdata(BatchBFSdata&& other)
          : person(other.person), componentSize(other.componentSize),
-           totalDistances(other.totalDistances), totalReachable(other.totalReachable)
-      { }
+           totalDistances(other.totalDistances), totalReachable(other.totalReachable), pruned(other.pruned)
+      {
+         std::copy(other.levelSums, other.levelSums+NUM_LEVEL_SUMS, levelSums);
+      }
+   };
+
+   /// Source of further BFS sources for a batch whose lanes become free before the batch finishes
+   class BatchSourceFeed {
+   public:
+      virtual ~BatchSourceFeed() { }
+
+      /// Appends up to max new sources to bfsData and returns how many were added
+      virtual size_t admit(std::vector<BatchBFSdata>& bfsData, size_t max) = 0;
+   };
+
+   /// Folds the number of vertices a source discovered at each distance into its levelSums
+   class LevelAccumulator {
+   public:
+      virtual ~LevelAccumulator() { }
+
+      /// Called once per BFS level in which the source discovered vertices
+      virtual void addLevel(BatchBFSdata& bfsData, uint32_t distance, uint32_t numDiscovered) = 0;
+
+      /// Vertices are only reported to accumulators that need them, this costs a pass over every frontier
+      virtual bool needsVertices() const {
+         return false;
+      }
+
+      /// Called for every vertex discovered in a round, bit l of the lane words is set if lane l discovered it
+      virtual void addVertex(PersonId /*person*/, uint32_t /*round*/, const uint64_t* /*lanes*/) {
+      }
+   };
+
+   /// Stops the BFS of sources whose result cannot be part of the query result anymore
+   class BatchSourcePruner {
+   public:
+      virtual ~BatchSourcePruner() { }
+
+      /// Called once per round before the active sources are checked
+      virtual void startRound() { }
+
+      /// False if the source cannot qualify, all vertices up to the given distance were found
+      virtual bool canQualify(const BatchBFSdata& bfsData, uint32_t distance) = 0;
    };
 }
\ No newline at end of file
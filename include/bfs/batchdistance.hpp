@@ -7,6 +7,7 @@
 #include "../macros.hpp"
 
 #include <cassert>
+#include <cstdint>
 #include <array>
 #include <cstring>
 
@@ -143,6 +144,35 @@ struct BatchDistance<uint64_t, width> {
    }
 };
 
+// Adds the byte counters of eight registers to numDistDiscovered, register a holds the counter of
+// source 8*b+a in byte b. Transposing with unpacks yields the counters in source order, so they are
+// widened and added sixteen at a time instead of extracting every byte. Works on one 128 bit lane.
+inline void addTransposedCounters(uint32_t* __restrict__ numDistDiscoveredBase, const __m128i* counters) {
+   // Interleave pairs of registers, 16, 32 and 64 bit groups then hold the counters of 2, 4 and 8 sources
+   __m128i pairs[8];
+   for(int a=0; a<8; a+=2) {
+      pairs[a] = _mm_unpacklo_epi8(counters[a], counters[a+1]);
+      pairs[a+1] = _mm_unpackhi_epi8(counters[a], counters[a+1]);
+   }
+   __m128i quads[8];
+   for(int a=0; a<8; a+=4) {
+      quads[a] = _mm_unpacklo_epi16(pairs[a], pairs[a+2]);
+      quads[a+1] = _mm_unpackhi_epi16(pairs[a], pairs[a+2]);
+      quads[a+2] = _mm_unpacklo_epi16(pairs[a+1], pairs[a+3]);
+      quads[a+3] = _mm_unpackhi_epi16(pairs[a+1], pairs[a+3]);
+   }
+   for(int q=0; q<4; q++) {
+      const __m128i sources[2] = {_mm_unpacklo_epi32(quads[q], quads[q+4]), _mm_unpackhi_epi32(quads[q], quads[q+4])};
+      for(int h=0; h<2; h++) {
+         __m128i* dst = reinterpret_cast<__m128i*>(numDistDiscoveredBase + 32*q + 16*h);
+         _mm_storeu_si128(dst+0, _mm_add_epi32(_mm_loadu_si128(dst+0), _mm_cvtepu8_epi32(sources[h])));
+         _mm_storeu_si128(dst+1, _mm_add_epi32(_mm_loadu_si128(dst+1), _mm_cvtepu8_epi32(_mm_srli_si128(sources[h], 4))));
+         _mm_storeu_si128(dst+2, _mm_add_epi32(_mm_loadu_si128(dst+2), _mm_cvtepu8_epi32(_mm_srli_si128(sources[h], 8))));
+         _mm_storeu_si128(dst+3, _mm_add_epi32(_mm_loadu_si128(dst+3), _mm_cvtepu8_epi32(_mm_srli_si128(sources[h], 12))));
+      }
+   }
+}
+
 // SSE Variant
 template<uint64_t width>
 struct BatchDistance<__m128i, width> {
@@ -181,26 +211,7 @@ struct BatchDistance<__m128i, width> {
    // }
 
    void updateDiscoveredNodes(const uint64_t partIx) {
-      for(unsigned a=0; a<8; a++) {
-         uint32_t*__restrict const numDistDiscoveredBase = (uint32_t*)__builtin_assume_aligned(numDistDiscovered + partIx*128+a, 4);
-         const auto localDiscoveredVal = localDiscovered[partIx*8+a];
-         numDistDiscoveredBase[8*0 ] += _mm_extract_epi8(localDiscoveredVal, 0);
-         numDistDiscoveredBase[8*1 ] += _mm_extract_epi8(localDiscoveredVal, 1);
-         numDistDiscoveredBase[8*2 ] += _mm_extract_epi8(localDiscoveredVal, 2);
-         numDistDiscoveredBase[8*3 ] += _mm_extract_epi8(localDiscoveredVal, 3);
-         numDistDiscoveredBase[8*4 ] += _mm_extract_epi8(localDiscoveredVal, 4);
-         numDistDiscoveredBase[8*5 ] += _mm_extract_epi8(localDiscoveredVal, 5);
-         numDistDiscoveredBase[8*6 ] += _mm_extract_epi8(localDiscoveredVal, 6);
-         numDistDiscoveredBase[8*7 ] += _mm_extract_epi8(localDiscoveredVal, 7);
-         numDistDiscoveredBase[8*8 ] += _mm_extract_epi8(localDiscoveredVal, 8);
-         numDistDiscoveredBase[8*9 ] += _mm_extract_epi8(localDiscoveredVal, 9);
-         numDistDiscoveredBase[8*10] += _mm_extract_epi8(localDiscoveredVal, 10);
-         numDistDiscoveredBase[8*11] += _mm_extract_epi8(localDiscoveredVal, 11);
-         numDistDiscoveredBase[8*12] += _mm_extract_epi8(localDiscoveredVal, 12);
-         numDistDiscoveredBase[8*13] += _mm_extract_epi8(localDiscoveredVal, 13);
-         numDistDiscoveredBase[8*14] += _mm_extract_epi8(localDiscoveredVal, 14);
-         numDistDiscoveredBase[8*15] += _mm_extract_epi8(localDiscoveredVal, 15);
-      }
+      addTransposedCounters(numDistDiscovered + partIx*128, localDiscovered + partIx*8);
       __m128i*__restrict const localDiscoveredBase = (__m128i*)__builtin_assume_aligned(localDiscovered + partIx*8, 16);
       for(int a=0; a<8; a++) {
          localDiscoveredBase[a] = allZeros;
@@ -275,42 +286,13 @@ struct BatchDistance<__m256i, width> {
    // }
 
    void updateDiscoveredNodes(const uint64_t partIx) {
+      __m128i lanes[2][8];
       for(unsigned a=0; a<8; a++) {
-         uint32_t*__restrict const numDistDiscoveredBase = (uint32_t*)__builtin_assume_aligned(numDistDiscovered + partIx*256+a, 4);
-         const __m256i localDiscoveredVal = localDiscovered[partIx*8+a];
-         numDistDiscoveredBase[8*0 ] += _mm256_extract_epi8(localDiscoveredVal, 0);
-         numDistDiscoveredBase[8*1 ] += _mm256_extract_epi8(localDiscoveredVal, 1);
-         numDistDiscoveredBase[8*2 ] += _mm256_extract_epi8(localDiscoveredVal, 2);
-         numDistDiscoveredBase[8*3 ] += _mm256_extract_epi8(localDiscoveredVal, 3);
-         numDistDiscoveredBase[8*4 ] += _mm256_extract_epi8(localDiscoveredVal, 4);
-         numDistDiscoveredBase[8*5 ] += _mm256_extract_epi8(localDiscoveredVal, 5);
-         numDistDiscoveredBase[8*6 ] += _mm256_extract_epi8(localDiscoveredVal, 6);
-         numDistDiscoveredBase[8*7 ] += _mm256_extract_epi8(localDiscoveredVal, 7);
-         numDistDiscoveredBase[8*8 ] += _mm256_extract_epi8(localDiscoveredVal, 8);
-         numDistDiscoveredBase[8*9 ] += _mm256_extract_epi8(localDiscoveredVal, 9);
-         numDistDiscoveredBase[8*10] += _mm256_extract_epi8(localDiscoveredVal, 10);
-         numDistDiscoveredBase[8*11] += _mm256_extract_epi8(localDiscoveredVal, 11);
-         numDistDiscoveredBase[8*12] += _mm256_extract_epi8(localDiscoveredVal, 12);
-         numDistDiscoveredBase[8*13] += _mm256_extract_epi8(localDiscoveredVal, 13);
-         numDistDiscoveredBase[8*14] += _mm256_extract_epi8(localDiscoveredVal, 14);
-         numDistDiscoveredBase[8*15] += _mm256_extract_epi8(localDiscoveredVal, 15);
-         numDistDiscoveredBase[8*16] += _mm256_extract_epi8(localDiscoveredVal, 16);
-         numDistDiscoveredBase[8*17] += _mm256_extract_epi8(localDiscoveredVal, 17);
-         numDistDiscoveredBase[8*18] += _mm256_extract_epi8(localDiscoveredVal, 18);
-         numDistDiscoveredBase[8*19] += _mm256_extract_epi8(localDiscoveredVal, 19);
-         numDistDiscoveredBase[8*20] += _mm256_extract_epi8(localDiscoveredVal, 20);
-         numDistDiscoveredBase[8*21] += _mm256_extract_epi8(localDiscoveredVal, 21);
-         numDistDiscoveredBase[8*22] += _mm256_extract_epi8(localDiscoveredVal, 22);
-         numDistDiscoveredBase[8*23] += _mm256_extract_epi8(localDiscoveredVal, 23);
-         numDistDiscoveredBase[8*24] += _mm256_extract_epi8(localDiscoveredVal, 24);
-         numDistDiscoveredBase[8*25] += _mm256_extract_epi8(localDiscoveredVal, 25);
-         numDistDiscoveredBase[8*26] += _mm256_extract_epi8(localDiscoveredVal, 26);
-         numDistDiscoveredBase[8*27] += _mm256_extract_epi8(localDiscoveredVal, 27);
-         numDistDiscoveredBase[8*28] += _mm256_extract_epi8(localDiscoveredVal, 28);
-         numDistDiscoveredBase[8*29] += _mm256_extract_epi8(localDiscoveredVal, 29);
-         numDistDiscoveredBase[8*30] += _mm256_extract_epi8(localDiscoveredVal, 30);
-         numDistDiscoveredBase[8*31] += _mm256_extract_epi8(localDiscoveredVal, 31);
+         lanes[0][a] = _mm256_castsi256_si128(localDiscovered[partIx*8+a]);
+         lanes[1][a] = _mm256_extracti128_si256(localDiscovered[partIx*8+a], 1);
       }
+      addTransposedCounters(numDistDiscovered + partIx*256, lanes[0]);
+      addTransposedCounters(numDistDiscovered + partIx*256 + 128, lanes[1]);
       __m256i*__restrict const localDiscoveredBase = (__m256i*)__builtin_assume_aligned(localDiscovered + partIx*8, 32);
       for(int a=0; a<8; a++) {
          localDiscoveredBase[a] = allZeros;
@@ -353,4 +335,80 @@ struct BatchDistance<__m256i, width> {
 };
 #endif
 
+// AVX-512 Variant
+#ifdef AVX512
+
+template<uint64_t width>
+struct BatchDistance<__m512i, width> {
+   uint32_t* numDistDiscovered;
+   uint8_t localDiscoveredIteration[width];
+   alignas(64) __m512i localDiscovered[8*width];
+   const __m512i allZeros = _mm512_setzero_si512();
+   const __m512i byteOnes = _mm512_set1_epi8(1);
+   // Shifts through the zero-masked form, the unmasked one passes an undefined register that g++ 12 warns about
+   static const __mmask8 allLanes = 0xFF;
+
+   BatchDistance(uint32_t* numDistDiscovered) : numDistDiscovered(numDistDiscovered), localDiscoveredIteration() {
+      memset(localDiscovered, 0, sizeof(__m512i)*8*width);
+      memset(localDiscoveredIteration, 0, width);
+   }
+   BatchDistance(BatchDistance<__m512i, width>&) = delete;
+   BatchDistance<__m512i, width>& operator=(BatchDistance<__m512i, width>&) = delete;
+   BatchDistance<__m512i, width>& operator=(BatchDistance<__m512i, width>&& other) = delete;
+
+   void updateDiscoveredNodes(const uint64_t partIx) {
+      __m128i lanes[4][8];
+      // Loads the 128 bit lanes from memory, the counters are stored there anyway
+      for(unsigned a=0; a<8; a++) {
+         const __m128i* counters = reinterpret_cast<const __m128i*>(&localDiscovered[partIx*8+a]);
+         lanes[0][a] = _mm_load_si128(counters);
+         lanes[1][a] = _mm_load_si128(counters+1);
+         lanes[2][a] = _mm_load_si128(counters+2);
+         lanes[3][a] = _mm_load_si128(counters+3);
+      }
+      for(unsigned l=0; l<4; l++) {
+         addTransposedCounters(numDistDiscovered + partIx*512 + 128*l, lanes[l]);
+      }
+      __m512i*__restrict const localDiscoveredBase = (__m512i*)__builtin_assume_aligned(localDiscovered + partIx*8, 64);
+      for(int a=0; a<8; a++) {
+         localDiscoveredBase[a] = allZeros;
+      }
+   }
+
+   inline void prefetch(uint64_t partIx) {
+      __builtin_prefetch(&localDiscovered[partIx*8],1);
+   }
+
+   void updateDiscovered(__m512i newVisits, uint64_t partIx) {
+
+      assert(partIx<=width);
+
+      __m512i*__restrict const localDiscoveredBase = (__m512i*)__builtin_assume_aligned(localDiscovered+partIx*8, 64);
+      localDiscoveredBase[0] = _mm512_add_epi8(localDiscoveredBase[0], _mm512_and_si512(newVisits, byteOnes));
+      localDiscoveredBase[1] = _mm512_add_epi8(localDiscoveredBase[1], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 1), byteOnes));
+      localDiscoveredBase[2] = _mm512_add_epi8(localDiscoveredBase[2], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 2), byteOnes));
+      localDiscoveredBase[3] = _mm512_add_epi8(localDiscoveredBase[3], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 3), byteOnes));
+      localDiscoveredBase[4] = _mm512_add_epi8(localDiscoveredBase[4], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 4), byteOnes));
+      localDiscoveredBase[5] = _mm512_add_epi8(localDiscoveredBase[5], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 5), byteOnes));
+      localDiscoveredBase[6] = _mm512_add_epi8(localDiscoveredBase[6], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 6), byteOnes));
+      localDiscoveredBase[7] = _mm512_add_epi8(localDiscoveredBase[7], _mm512_and_si512(_mm512_maskz_srli_epi64(allLanes, newVisits, 7), byteOnes));
+
+      if(localDiscoveredIteration[partIx]==254) {
+         updateDiscoveredNodes(partIx);
+         localDiscoveredIteration[partIx]=0;
+      } else {
+         localDiscoveredIteration[partIx]++;
+      }
+   }
+
+   void finalize() {
+      for (unsigned i = 0; i < width; ++i) {
+         updateDiscoveredNodes(i);
+      }
+      memset(localDiscovered, 0, sizeof(__m512i)*8*width);
+      memset(localDiscoveredIteration, 0, width);
+   }
+};
+#endif
+
 }
\ No newline at end of file
@@ -7,9 +7,14 @@
 #include "statistics.hpp"
 #include "base.hpp"
 #include "batchdistance.hpp"
+#include "batchteam.hpp"
+#include "direction.hpp"
 #include "bitops.hpp"
+#include <algorithm>
 #include <array>
 #include <cstring>
+#include <new>
+#include <type_traits>
 
 #define SORTED_NEIGHBOR_PROCESSING
 #define DO_PREFETCH
@@ -27,7 +32,6 @@ struct BatchBits {
    BatchBits() : data() {
    }
 
-   #ifdef DEBUG
    bool isAllZero() const {
       for (unsigned i = 0; i < width; ++i) {
          if(BitBaseOp<bit_t>::notZero(data[i])) {
@@ -37,7 +41,6 @@ struct BatchBits {
 
       return true;
    }
-   #endif
 
    #ifdef STATISTICS
    size_t count() const {
@@ -62,8 +65,39 @@ struct BatchBits {
    }
 };
 static const unsigned int PREFETCH=38;
-// General HugeBatchBFS loop
-template<typename bit_t=uint64_t, uint64_t width=1, bool detectSingle=false, uint32_t alpha=14, uint32_t beta=24>
+// Top-down rounds iterate an explicit vertex list while at most 1/SPARSE_FRONTIER of the vertices are active
+static const unsigned int SPARSE_FRONTIER=32;
+// Lanes of finished sources are refilled once at least 1/REFILL_FRACTION of the lanes are free
+static const unsigned int REFILL_FRACTION=2;
+
+// Vertices with a non-empty visit list, only complete if valid is set. The summary has the
+// same vertices as bitmap for dense rounds, it is empty again once the frontier was processed.
+struct SparseFrontier {
+   PersonId* ids;
+   uint32_t size;
+   bool valid;
+   VertexSummary* summary;
+
+   void clear() {
+      size = 0;
+      valid = false;
+   }
+
+   void add(const PersonId person) {
+      ids[size++] = person;
+   }
+
+   // Decides whether the next top-down round can use the vertex list
+   void finish(const PersonId limit) {
+      valid = size <= limit/SPARSE_FRONTIER;
+      if(valid) {
+         std::sort(ids, ids+size);
+      }
+   }
+};
+
+// General HugeBatchBFS loop, DistanceT counts the newly discovered vertices per source
+template<typename bit_t=uint64_t, uint64_t width=1, bool detectSingle=false, uint32_t alpha=14, uint32_t beta=24, typename DistanceT=BatchDistance<bit_t, width>>
 struct HugeBatchBfs {
    static const size_t TYPE=3;
    static const size_t WIDTH=width;
@@ -77,129 +111,165 @@ struct HugeBatchBfs {
       return BATCH_BITS_COUNT;
    }
 
-   static void runBatch(std::vector<BatchBFSdata>& bfsData, const PersonSubgraph& subgraph
+   /// State of one batch between two rounds, so that a thread can interleave the rounds of several batches.
+   /// With a feed, the lanes of finished sources are refilled with new sources that are appended to bfsData.
+   /// With a pruner, sources that cannot qualify for the result are stopped after each round. An accumulator
+   /// gets the number of vertices each source discovered per level.
+   template<typename GraphT>
+   class BatchRun {
+      std::vector<BatchBFSdata>& bfsData;
+      const GraphT& subgraph;
       #ifdef STATISTICS
-      , BatchStatistics& statistics
+      BatchStatistics& statistics;
       #endif
-      ) {
-
-      const auto subgraphSize = subgraph.size();
+      BatchSourceFeed* const feed;
+      BatchSourcePruner* const pruner;
+      LevelAccumulator* const accumulator;
+      const PersonId subgraphSize;
 
-      // Initialize visit lists
+      TouchedRange& touched;
       std::array<Bitset*,2> visitLists;
-      for(int a=0; a<2; a++) {
-         const auto ret=posix_memalign(reinterpret_cast<void**>(&(visitLists[a])),64,sizeof(Bitset)*subgraphSize);
-         if(unlikely(ret!=0)) {
-            throw -1;
-         }
-         new(visitLists[a]) Bitset[subgraphSize]();
-      }
-
-
-      const uint32_t numQueries = bfsData.size();
-      assert(numQueries>0 && numQueries<=BATCH_BITS_COUNT);
-
-      // Initialize seen vector
-      PersonId minPerson = std::numeric_limits<PersonId>::max();
       Bitset* seen;
-      const auto ret=posix_memalign(reinterpret_cast<void**>(&seen),64,sizeof(Bitset)*subgraphSize);
-      if(unlikely(ret!=0)) {
-         throw -1;
-      }
-      new(seen) Bitset[subgraphSize]();
+      // Dense rounds are split across the team of this thread, if there is one
+      BatchTeam* const team;
+      std::array<SparseFrontier,2> frontiers;
+      VertexSummary& pending;
 
       #ifdef BI_DIRECTIONAl
-      bool topDown = true;
-      uint64_t unexploredEdges = subgraph.numEdges;
-      uint64_t visitNeighbors = 0;
-      uint32_t frontierSize = numQueries;
+      bool topDown;
+      uint64_t unexploredEdges;
+      uint64_t visitNeighbors;
+      uint32_t frontierSize;
+      // Direction costs learned from the previous rounds and batches of this thread
+      DirectionPolicy& policy;
       #endif
 
-      // Initialize active queries
-      for(size_t pos=0; pos<numQueries; pos++) {
-         assert(seen[bfsData[pos].person].isAllZero());
-         seen[bfsData[pos].person].setBit(pos);
-         assert(!seen[bfsData[pos].person].isAllZero());
-         (visitLists[0])[bfsData[pos].person].setBit(pos);
-         minPerson = std::min(minPerson, bfsData[pos].person);
+      Bitset processQuery;
+      // Source of each lane and the round before its source was admitted
+      uint32_t numLanes;
+      uint32_t laneSource[BATCH_BITS_COUNT];
+      uint32_t laneOffset[BATCH_BITS_COUNT];
 
+      uint32_t queriesToProcess;
+      alignas(64) uint32_t numDistDiscovered[BATCH_BITS_COUNT];
+      DistanceT batchDist;
+
+      size_t curToVisitQueue;
+      uint32_t nextDistance;
+      PersonId startPerson;
+
+   public:
+      BatchRun(std::vector<BatchBFSdata>& bfsData, const GraphT& subgraph
+         #ifdef STATISTICS
+         , BatchStatistics& statistics
+         #endif
+         , BitsetWorkspace& workspace, BatchSourceFeed* feed, BatchSourcePruner* pruner, LevelAccumulator* accumulator)
+         : bfsData(bfsData), subgraph(subgraph)
+         #ifdef STATISTICS
+         , statistics(statistics)
+         #endif
+         , feed(feed), pruner(pruner), accumulator(accumulator), subgraphSize(subgraph.size()), touched(workspace.touched), seen(workspace.get<Bitset>(2)), team(getThreadLocalBatchTeam()), pending(workspace.pending)
          #ifdef BI_DIRECTIONAl
-         visitNeighbors += subgraph.retrieve(bfsData[pos].person)->size();
+         , topDown(true), unexploredEdges(subgraph.numEdges), visitNeighbors(0), frontierSize(bfsData.size())
+         , policy(getThreadLocalDirectionPolicy<std::pair<HugeBatchBfs,GraphT>>())
          #endif
-      }
+         , numLanes(bfsData.size()), queriesToProcess(bfsData.size()), batchDist(numDistDiscovered), curToVisitQueue(0), nextDistance(1) {
+
+         // Initialize visit lists and seen vector, reused from previous batches of this thread
+         for(int a=0; a<2; a++) {
+            visitLists[a] = workspace.get<Bitset>(a);
+            frontiers[a].ids = workspace.getFrontierIds(a);
+            frontiers[a].summary = &workspace.summaries[a];
+            frontiers[a].summary->clear();
+            frontiers[a].clear();
+         }
+         pending.valid = false;
 
-      // Initialize iteration workstate
-      Bitset processQuery;
-      processQuery.negate();
+         const uint32_t numQueries = bfsData.size();
+         assert(numQueries>0 && numQueries<=BATCH_BITS_COUNT);
 
-      uint32_t queriesToProcess=numQueries;
-      alignas(64) uint32_t numDistDiscovered[BATCH_BITS_COUNT];
-      memset(numDistDiscovered,0,BATCH_BITS_COUNT*sizeof(uint32_t));
+         #ifdef BI_DIRECTIONAl
+         policy.startBatch(subgraphSize, subgraph.numEdges);
+         #endif
 
-      BatchDistance<bit_t, width> batchDist(numDistDiscovered);
+         // Initialize active queries
+         PersonId minPerson = std::numeric_limits<PersonId>::max();
+         for(size_t pos=0; pos<numQueries; pos++) {
+            assert(seen[bfsData[pos].person].isAllZero());
+            seen[bfsData[pos].person].setBit(pos);
+            assert(!seen[bfsData[pos].person].isAllZero());
+            (visitLists[0])[bfsData[pos].person].setBit(pos);
+            minPerson = std::min(minPerson, bfsData[pos].person);
+            touched.add(bfsData[pos].person);
+            frontiers[0].add(bfsData[pos].person);
+            frontiers[0].summary->set(bfsData[pos].person);
+
+            #ifdef BI_DIRECTIONAl
+            visitNeighbors += subgraph.degree(bfsData[pos].person);
+            #endif
+         }
+         startPerson = minPerson;
 
-      size_t curToVisitQueue = 0;
-      uint32_t nextDistance = 1;
+         frontiers[0].finish(subgraphSize);
+         frontiers[0].summary->valid = true;
 
-      PersonId startPerson=minPerson;
+         // Initialize iteration workstate, only the bits of actual queries are active
+         for(uint32_t pos=0; pos<numQueries; pos++) {
+            processQuery.setBit(pos);
+            laneSource[pos] = pos;
+            laneOffset[pos] = 0;
+         }
+
+         memset(numDistDiscovered,0,BATCH_BITS_COUNT*sizeof(uint32_t));
+      }
+
+      BatchRun(const BatchRun&) = delete;
+      BatchRun& operator=(const BatchRun&) = delete;
 
-      // Run iterations
-      do {
+      /// Runs the next round, returns false once all sources finished
+      bool step() {
          size_t startTime = tschrono::now();
          Bitset* const toVisit = visitLists[curToVisitQueue];
          Bitset* const nextToVisit = visitLists[1-curToVisitQueue];
+         const SparseFrontier& frontier = frontiers[curToVisitQueue];
+         SparseFrontier& nextFrontier = frontiers[1-curToVisitQueue];
 
          assert(toVisit!=nullptr);
          assert(nextToVisit!=nullptr);
 
          #ifdef BI_DIRECTIONAl
          unexploredEdges -= visitNeighbors;
+         // The fixed heuristic switches to bottom-up for large frontiers and back once the frontier shrinks
+         const bool heuristicTopDown = topDown ? visitNeighbors <= unexploredEdges / alpha : frontierSize < subgraphSize / beta;
+         // Top-down expands the frontier, bottom-up checks the unseen vertices until a seen neighbor is found
+         const uint64_t topDownWork = visitNeighbors + (frontier.valid ? 0 : subgraphSize);
+         const uint64_t bottomUpWork = unexploredEdges + subgraphSize;
+         topDown = policy.chooseTopDown(nextDistance, heuristicTopDown, topDownWork, bottomUpWork);
+         const uint64_t roundStart = DirectionPolicy::now();
          std::pair<uint32_t, uint64_t> frontierInfo;
          if(topDown) {
-            if(visitNeighbors <= unexploredEdges / alpha) {
-               frontierInfo = runBatchRound(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery
-                  #if defined(STATISTICS)
-                  , statistics, nextDistance
-                  #elif defined(TRACE)
-                  , nextDistance
-                  #endif
-                  );
-               topDown = true;
-            } else {
-               frontierInfo = runBatchRoundRev(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery
-                  #if defined(STATISTICS)
-                  , statistics, nextDistance
-                  #elif defined(TRACE)
-                  , nextDistance
-                  #endif
-                  );
-               topDown = false;
-            }
+            frontierInfo = runBatchRound(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery, touched, team, frontier, nextFrontier
+               #if defined(STATISTICS)
+               , statistics, nextDistance
+               #elif defined(TRACE)
+               , nextDistance
+               #endif
+               );
          } else {
-            if(frontierSize >= subgraphSize / beta) {
-               frontierInfo = runBatchRoundRev(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery
-                  #if defined(STATISTICS)
-                  , statistics, nextDistance
-                  #elif defined(TRACE)
-                  , nextDistance
-                  #endif
-                  );
-               topDown = false;
-            } else {
-               frontierInfo = runBatchRound(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery
-                  #if defined(STATISTICS)
-                  , statistics, nextDistance
-                  #elif defined(TRACE)
-                  , nextDistance
-                  #endif
-                  );
-               topDown = true;
-            } 
+            // Bottom-up checks every unseen vertex, these may precede the first source
+            frontierInfo = runBatchRoundRev(subgraph, 0, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery, touched, team, frontier, nextFrontier, pending
+               #if defined(STATISTICS)
+               , statistics, nextDistance
+               #elif defined(TRACE)
+               , nextDistance
+               #endif
+               );
          }
+         policy.record(nextDistance, topDown, topDown ? topDownWork : bottomUpWork, DirectionPolicy::now()-roundStart);
          frontierSize = frontierInfo.first;
          visitNeighbors = frontierInfo.second;
          #else
-         runBatchRound(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery
+         runBatchRound(subgraph, startPerson, subgraphSize, toVisit, nextToVisit, seen, batchDist, processQuery, touched, team, frontier, nextFrontier
                   #if defined(STATISTICS)
                   , statistics, nextDistance
                   #elif defined(TRACE)
@@ -208,13 +278,22 @@ struct HugeBatchBfs {
                   );
          #endif
 
+         if(accumulator!=nullptr && accumulator->needsVertices()) {
+            reportVertices(nextToVisit, nextFrontier);
+         }
+
          // Update stats for all processed queries and check if the query is finished
          #ifdef DEBUG
          uint64_t newReached = 0;
          uint64_t numNotZero = 0;
          #endif
-         for(uint32_t pos=0; pos<numQueries; pos++) {
-            updateProcessQuery(processQuery, pos, numDistDiscovered[pos], bfsData[pos], nextDistance, queriesToProcess);
+         for(uint32_t pos=0; pos<numLanes; pos++) {
+            // Sources that finish in this round still report their last level
+            const bool active = isLaneActive(processQuery, pos);
+            updateProcessQuery(processQuery, pos, numDistDiscovered[pos], bfsData[laneSource[pos]], nextDistance-laneOffset[pos], queriesToProcess);
+            if(accumulator!=nullptr && active && numDistDiscovered[pos]>0) {
+               accumulator->addLevel(bfsData[laneSource[pos]], nextDistance-laneOffset[pos], numDistDiscovered[pos]);
+            }
             #ifdef DEBUG
             if(numDistDiscovered[pos]>0) {
                newReached += numDistDiscovered[pos];
@@ -222,13 +301,23 @@ struct HugeBatchBfs {
             }
             #endif
          }
+         if(pruner!=nullptr) {
+            pruneSources();
+         }
 
          TraceStats<BATCH_BITS_COUNT>& stats = TraceStats<BATCH_BITS_COUNT>::getStats();
          stats.traceRound(nextDistance);
          stats.addRoundDuration(nextDistance, (tschrono::now()-startTime));
 
          if(queriesToProcess==0) {
-            break;
+            #ifdef BI_DIRECTIONAl
+            policy.finishBatch();
+            #endif
+
+            #ifdef STATISTICS
+            statistics.finishBatch();
+            #endif
+            return false;
          }
          nextDistance++;
 
@@ -242,61 +331,263 @@ struct HugeBatchBfs {
          // Swap queues
          startPerson = 0;
          curToVisitQueue = 1-curToVisitQueue;
-      } while(true);
 
-      free(seen);
-      for(int a=0; a<2; a++) {
-         free(visitLists[a]);
+         // Refill once enough lanes are free, a batch without active sources ends instead
+         if(feed!=nullptr && BATCH_BITS_COUNT-queriesToProcess >= BATCH_BITS_COUNT/REFILL_FRACTION) {
+            #ifdef BI_DIRECTIONAl
+            const uint32_t activeBefore = queriesToProcess;
+            #else
+            uint32_t frontierSize = 0;
+            uint64_t visitNeighbors = 0;
+            #endif
+            const uint32_t numAdmitted = refillLanes(*feed, bfsData, subgraph, processQuery, visitLists[curToVisitQueue], seen, touched, frontiers[curToVisitQueue], pending,
+               laneSource, laneOffset, numLanes, nextDistance-1, queriesToProcess, frontierSize, visitNeighbors);
+            #ifdef BI_DIRECTIONAl
+            // The new sources have not explored any edges yet
+            if(numAdmitted>0) {
+               unexploredEdges += (subgraph.numEdges-unexploredEdges)*numAdmitted/(activeBefore+numAdmitted);
+            }
+            #else
+            (void)numAdmitted;
+            #endif
+         }
+         return true;
       }
 
+      // Hands the vertices discovered in this round to the accumulator, these have visit bits in the next round
+      void reportVertices(const Bitset* discovered, const SparseFrontier& nextFrontier) {
+         uint64_t lanes[(sizeof(Bitset)+7)/8];
+         auto report = [&](const PersonId person) {
+            if(discovered[person].isAllZero()) {
+               return;
+            }
+            lanes[sizeof(lanes)/8-1] = 0;
+            memcpy(lanes, discovered+person, sizeof(Bitset));
+            accumulator->addVertex(person, nextDistance, lanes);
+         };
+         if(nextFrontier.valid) {
+            for(uint32_t f=0; f<nextFrontier.size; f++) {
+               report(nextFrontier.ids[f]);
+            }
+            return;
+         }
+         const VertexSummary& summary = *nextFrontier.summary;
+         const size_t endWord = (subgraphSize+63)/64;
+         for(size_t w=summary.nextWord(0, endWord); w<endWord; w=summary.nextWord(w+1, endWord)) {
+            uint64_t candidates = summary.candidates(w, 0, subgraphSize);
+            while(candidates!=0) {
+               report(w*64+__builtin_ctzl(candidates));
+               candidates &= candidates-1;
+            }
+         }
+      }
+
+      // Stops the active sources that cannot qualify anymore, their lanes are free for refills
+      void pruneSources() {
+         pruner->startRound();
+         for(uint32_t pos=0; pos<numLanes; pos++) {
+            if(!isLaneActive(processQuery, pos)) {
+               continue;
+            }
+            BatchBFSdata& source = bfsData[laneSource[pos]];
+            if(!pruner->canQualify(source, nextDistance-laneOffset[pos])) {
+               source.pruned = true;
+               const auto field = pos/TYPE_BITS;
+               processQuery.data[field] = BitBaseOp<bit_t>::andNot(processQuery.data[field], BitBaseOp<bit_t>::getSetMask(pos-field*TYPE_BITS));
+               queriesToProcess--;
+            }
+         }
+      }
+
+      /// Prefetches the bitsets the next round starts with, issued while another batch runs its round
+      void prefetchRound() const {
+         const Bitset* const toVisit = visitLists[curToVisitQueue];
+         const SparseFrontier& frontier = frontiers[curToVisitQueue];
+         if(frontier.valid) {
+            const uint32_t n = std::min<uint32_t>(PREFETCH, frontier.size);
+            for(uint32_t f=0; f<n; f++) {
+               __builtin_prefetch(toVisit + frontier.ids[f], 0);
+            }
+         } else {
+            const PersonId end = std::min<PersonId>(startPerson+PREFETCH, subgraphSize);
+            for(PersonId person=startPerson; person<end; person++) {
+               __builtin_prefetch(toVisit + person, 0);
+               __builtin_prefetch(seen + person, 0);
+            }
+         }
+      }
+   };
+
+   template<typename GraphT>
+   static void runBatch(std::vector<BatchBFSdata>& bfsData, const GraphT& subgraph
       #ifdef STATISTICS
-      statistics.finishBatch();
+      , BatchStatistics& statistics
       #endif
+      , BatchSourceFeed* feed=nullptr, BatchSourcePruner* pruner=nullptr, LevelAccumulator* accumulator=nullptr
+      ) {
+      BitsetWorkspace& workspace = getThreadLocalBitsetWorkspace(subgraph.size(), sizeof(Bitset));
+      BatchRun<GraphT> run(bfsData, subgraph
+         #ifdef STATISTICS
+         , statistics
+         #endif
+         , workspace, feed, pruner, accumulator);
+      while(run.step()) {
+      }
    }
 
+   /// Runs up to MAX_THREAD_WORKSPACES batches on the calling thread, interleaved round by round. Each batch
+   /// uses its own workspace, and the next batch's first bitsets are prefetched while a batch runs its round.
+   /// All batches refill their lanes from the same feed.
+   template<typename GraphT>
+   static void runBatches(std::vector<std::vector<BatchBFSdata>>& batches, const GraphT& subgraph
+      #ifdef STATISTICS
+      , BatchStatistics& statistics
+      #endif
+      , BatchSourceFeed* feed=nullptr, BatchSourcePruner* pruner=nullptr, LevelAccumulator* accumulator=nullptr
+      ) {
+      assert(batches.size()<=MAX_THREAD_WORKSPACES);
+      typedef BatchRun<GraphT> Run;
+      typename std::aligned_storage<sizeof(Run), alignof(Run)>::type storage[MAX_THREAD_WORKSPACES];
+      std::array<Run*, MAX_THREAD_WORKSPACES> runs;
+      unsigned numRuns = 0;
+      for(auto& batch : batches) {
+         if(batch.empty()) {
+            continue;
+         }
+         BitsetWorkspace& workspace = getThreadLocalBitsetWorkspace(subgraph.size(), sizeof(Bitset), numRuns);
+         runs[numRuns] = new (&storage[numRuns]) Run(batch, subgraph
+            #ifdef STATISTICS
+            , statistics
+            #endif
+            , workspace, feed, pruner, accumulator);
+         numRuns++;
+      }
+
+      // Finished runs are swapped to the end
+      unsigned numActive = numRuns;
+      unsigned current = 0;
+      while(numActive>0) {
+         if(numActive>1) {
+            runs[(current+1)%numActive]->prefetchRound();
+         }
+         if(runs[current]->step()) {
+            current++;
+         } else {
+            numActive--;
+            std::swap(runs[current], runs[numActive]);
+         }
+         if(current>=numActive) {
+            current = 0;
+         }
+      }
+
+      for(unsigned r=0; r<numRuns; r++) {
+         runs[r]->~Run();
+      }
+   }
+
+
+   // Assigns new sources from the feed to the lanes that are not active. The lanes are cleared in the
+   // seen and visit bitsets, the new sources start with the next round.
+   template<typename GraphT>
+   static uint32_t refillLanes(BatchSourceFeed& feed, std::vector<BatchBFSdata>& bfsData, const GraphT& subgraph, Bitset& processQuery, Bitset* visitList, Bitset* seen, TouchedRange& touched, SparseFrontier& frontier, VertexSummary& pending,
+      uint32_t* laneSource, uint32_t* laneOffset, uint32_t& numLanes, const uint32_t offset, uint32_t& queriesToProcess, uint32_t& frontierSize, uint64_t& visitNeighbors) {
+      const size_t firstNew = bfsData.size();
+      const uint32_t numAdmitted = feed.admit(bfsData, BATCH_BITS_COUNT-queriesToProcess);
+      if(numAdmitted==0) {
+         return 0;
+      }
+
+      Bitset freed;
+      size_t nextSource = firstNew;
+      for(uint32_t lane=0; nextSource<bfsData.size(); lane++) {
+         assert(lane<BATCH_BITS_COUNT);
+         const auto field = lane/TYPE_BITS;
+         if(BitBaseOp<bit_t>::notZero(processQuery.data[field] & BitBaseOp<bit_t>::getSetMask(lane-field*TYPE_BITS))) {
+            continue;
+         }
+         freed.setBit(lane);
+         laneSource[lane] = nextSource++;
+         laneOffset[lane] = offset;
+         numLanes = std::max(numLanes, lane+1);
+      }
+
+      for(PersonId person=touched.begin; person<touched.end; person++) {
+         for(unsigned i=0; i<width; i++) {
+            seen[person].data[i] = BitBaseOp<bit_t>::andNot(seen[person].data[i], freed.data[i]);
+            visitList[person].data[i] = BitBaseOp<bit_t>::andNot(visitList[person].data[i], freed.data[i]);
+         }
+      }
+
+      for(uint32_t lane=0; lane<numLanes; lane++) {
+         const auto field = lane/TYPE_BITS;
+         if(BitBaseOp<bit_t>::isZero(freed.data[field] & BitBaseOp<bit_t>::getSetMask(lane-field*TYPE_BITS))) {
+            continue;
+         }
+         const PersonId person = bfsData[laneSource[lane]].person;
+         bool inFrontier = false;
+         for(unsigned i=0; i<width; i++) {
+            inFrontier |= BitBaseOp<bit_t>::notZero(visitList[person].data[i]);
+         }
+         if(!inFrontier) {
+            frontierSize++;
+            visitNeighbors += subgraph.degree(person);
+            if(frontier.valid) {
+               frontier.add(person);
+            }
+            frontier.summary->set(person);
+         }
+         seen[person].setBit(lane);
+         visitList[person].setBit(lane);
+         processQuery.setBit(lane);
+         touched.add(person);
+      }
+      if(frontier.valid) {
+         frontier.finish(subgraph.size());
+      }
+      // Vertices that all previous sources had reached are missing the new ones
+      pending.valid = false;
+
+      queriesToProcess += numAdmitted;
+      return numAdmitted;
+   }
 
    #ifdef SORTED_NEIGHBOR_PROCESSING
 
-   static std::pair<uint32_t,uint64_t> __attribute__((hot)) runBatchRound(const PersonSubgraph& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, BatchDistance<bit_t, width>& batchDist, const Bitset processQuery
+   // Top-down round over the vertex list of a sparse frontier. Vertices whose next visit list becomes
+   // non-empty are collected while expanding, so no round touches the bitsets of all vertices.
+   template<typename GraphT>
+   static std::pair<uint32_t,uint64_t> __attribute__((hot)) runBatchRoundSparse(const GraphT& subgraph, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, DistanceT& batchDist, const Bitset processQuery, TouchedRange& touched, const SparseFrontier& frontier, SparseFrontier& nextFrontier
       #if defined(STATISTICS)
       , BatchStatistics& statistics, uint32_t nextDistance
       #elif defined(TRACE)
       , uint32_t nextDistance
       #endif
    ) {
-         // volatile bit_t pref;
-      #ifdef DO_PREFETCH
-      const int p2=min(PREFETCH, (unsigned int)(limit-startPerson));
-      for(int a=1; a<p2; a++) {
-         __builtin_prefetch(visitList + a,0);
-         // pref=(visitList + a)->data[0];
-      }
-      #endif
-
       #ifdef TRACE
       size_t numBitsSet[BATCH_BITS_COUNT];
-      size_t numFriendsAnalyzed = 0;
       size_t numNewSeen[BATCH_BITS_COUNT];
       memset(numBitsSet, 0, sizeof(size_t)*BATCH_BITS_COUNT);
       memset(numNewSeen, 0, sizeof(size_t)*BATCH_BITS_COUNT);
-      std::vector<uint64_t> xx(513);
+      numBitsSet[0] = limit-frontier.size;
       #endif
 
-
-      for (PersonId curPerson = startPerson; curPerson<limit; ++curPerson) {
+      nextFrontier.clear();
+      for(uint32_t f=0; f<frontier.size; f++) {
+         const PersonId curPerson = frontier.ids[f];
          auto curVisit = visitList[curPerson];
+         frontier.summary->unset(curPerson);
 
          #ifdef DO_PREFETCH
-         if(curPerson+PREFETCH < limit) {
-            __builtin_prefetch(visitList + curPerson + PREFETCH,0);
-            // pref=(visitList + curPerson + PREFETCH)->data[0];
+         if(f+PREFETCH < frontier.size) {
+            __builtin_prefetch(visitList + frontier.ids[f+PREFETCH],0);
          }
          #endif
 
          #ifdef TRACE
          {
             size_t bitsSet = 0;
-            for(int i=0; i<width; i++) {
+            for(unsigned i=0; i<width; i++) {
                bitsSet += BitBaseOp<bit_t>::popCount(curVisit.data[i]);
             }
             numBitsSet[bitsSet]++;
@@ -304,66 +595,234 @@ struct HugeBatchBfs {
          #endif
 
          bool zero=true;
-         for(int i=0; i<width; i++) {
+         for(unsigned i=0; i<width; i++) {
+            curVisit.data[i] &= processQuery.data[i];
+            visitList[curPerson].data[i] = BitBaseOp<bit_t>::zero();
             if(BitBaseOp<bit_t>::notZero(curVisit.data[i])) {
                zero=false;
-               break;
             }
          }
          if(zero) {
             continue;
          }
 
-         const auto& curFriends=*subgraph.retrieve(curPerson);
-         auto friendsBounds = curFriends.bounds();
+         auto friendsBounds = subgraph.neighbors(curPerson);
          #ifdef DO_PREFETCH
          const int p=min(PREFETCH, (unsigned int)(friendsBounds.second-friendsBounds.first));
          for(int a=1; a<p; a++) {
             __builtin_prefetch(nextVisitList + *(friendsBounds.first+a),1);
-            // pref=(nextVisitList + *(friendsBounds.first+a))->data[0];
          }
          #endif
-         for(int i=0; i<width; i++) {
-            curVisit.data[i] &= processQuery.data[i];
-         }
          while(friendsBounds.first != friendsBounds.second) {
             #ifdef DO_PREFETCH
             if(friendsBounds.first+PREFETCH < friendsBounds.second) {
                __builtin_prefetch(nextVisitList + *(friendsBounds.first+PREFETCH),1);
-               // pref=(nextVisitList + *(friendsBounds.first+PREFETCH))->data[0];
             }
             #endif
 
+            Bitset& nextVisit = nextVisitList[*friendsBounds.first];
+
             #ifdef TRACE
             {
-               numFriendsAnalyzed++;
                size_t newBits = 0;
-               for(int i=0; i<width; i++) {
-                  newBits += BitBaseOp<bit_t>::popCount(nextVisitList[*friendsBounds.first].data[i] | curVisit.data[i])
-                     - BitBaseOp<bit_t>::popCount(nextVisitList[*friendsBounds.first].data[i] );
+               for(unsigned i=0; i<width; i++) {
+                  newBits += BitBaseOp<bit_t>::popCount(nextVisit.data[i] | curVisit.data[i])
+                     - BitBaseOp<bit_t>::popCount(nextVisit.data[i]);
                }
                numNewSeen[newBits]++;
             }
             #endif
 
-            for(int i=0; i<width; i++) {
-               nextVisitList[*friendsBounds.first].data[i] |= curVisit.data[i];
+            bool wasEmpty=true;
+            for(unsigned i=0; i<width; i++) {
+               if(BitBaseOp<bit_t>::notZero(nextVisit.data[i])) {
+                  wasEmpty=false;
+               }
+               nextVisit.data[i] |= curVisit.data[i];
+            }
+            if(wasEmpty) {
+               nextFrontier.add(*friendsBounds.first);
             }
             ++friendsBounds.first;
+         }
       }
-         for(int i=0; i<width; i++) {
-            visitList[curPerson].data[i] = BitBaseOp<bit_t>::zero();
+
+      // Keep only the candidates that reached unseen vertices
+      uint32_t frontierSize = 0;
+      uint64_t nextVisitNeighbors = 0;
+      for(uint32_t c=0; c<nextFrontier.size; c++) {
+         const PersonId curPerson = nextFrontier.ids[c];
+
+         #ifdef DO_PREFETCH
+         if(c+PREFETCH < nextFrontier.size) {
+            __builtin_prefetch(seen + nextFrontier.ids[c+PREFETCH],1);
+         }
+         #endif
+
+         bool nextVisitNonzero=false;
+         for(unsigned i=0; i<width; i++) {
+            const bit_t newVisits = BitBaseOp<bit_t>::andNot(nextVisitList[curPerson].data[i], seen[curPerson].data[i]);
+            nextVisitList[curPerson].data[i] = newVisits;
+            if(BitBaseOp<bit_t>::notZero(newVisits)) {
+               seen[curPerson].data[i] |= newVisits;
+               batchDist.updateDiscovered(newVisits, i);
+               nextVisitNonzero = true;
+            }
+         }
+         if(nextVisitNonzero) {
+            touched.add(curPerson);
+            nextFrontier.ids[frontierSize++] = curPerson;
+            nextFrontier.summary->set(curPerson);
+            nextVisitNeighbors += subgraph.degree(curPerson);
+         }
+      }
+      nextFrontier.size = frontierSize;
+      nextFrontier.finish(limit);
+      nextFrontier.summary->valid = true;
+
+      #ifdef TRACE
+      {
+         TraceStats<BATCH_BITS_COUNT>& stats = TraceStats<BATCH_BITS_COUNT>::getStats();
+         for (int i = 0; i < BATCH_BITS_COUNT; ++i) {
+            stats.addRoundVisitBits(nextDistance, i, numBitsSet[i]);
+            stats.addRoundFriendBits(nextDistance, i, numNewSeen[i]);
+         }
+      }
+      #endif
+
+      batchDist.finalize();
+      return std::make_pair(frontierSize, nextVisitNeighbors);
+   }
+
+   template<typename GraphT>
+   static std::pair<uint32_t,uint64_t> __attribute__((hot)) runBatchRound(const GraphT& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, DistanceT& batchDist, const Bitset processQuery, TouchedRange& touched, BatchTeam* team, const SparseFrontier& frontier, SparseFrontier& nextFrontier
+      #if defined(STATISTICS)
+      , BatchStatistics& statistics, uint32_t nextDistance
+      #elif defined(TRACE)
+      , uint32_t nextDistance
+      #endif
+   ) {
+      if(frontier.valid) {
+         return runBatchRoundSparse(subgraph, limit, visitList, nextVisitList, seen, batchDist, processQuery, touched, frontier, nextFrontier
+            #if defined(STATISTICS)
+            , statistics, nextDistance
+            #elif defined(TRACE)
+            , nextDistance
+            #endif
+            );
+      }
+      if(team!=nullptr) {
+         frontier.summary->clear();
+         nextFrontier.summary->valid = false;
+         return runBatchRoundTeam(*team, subgraph, startPerson, limit, visitList, nextVisitList, seen, batchDist, processQuery, touched, nextFrontier);
+      }
+
+         // volatile bit_t pref;
+      #ifdef DO_PREFETCH
+      const int p2=min(PREFETCH, (unsigned int)(limit-startPerson));
+      for(int a=1; a<p2; a++) {
+         __builtin_prefetch(visitList + a,0);
+         // pref=(visitList + a)->data[0];
+      }
+      #endif
+
+      #ifdef TRACE
+      size_t numBitsSet[BATCH_BITS_COUNT];
+      size_t numFriendsAnalyzed = 0;
+      size_t numNewSeen[BATCH_BITS_COUNT];
+      memset(numBitsSet, 0, sizeof(size_t)*BATCH_BITS_COUNT);
+      memset(numNewSeen, 0, sizeof(size_t)*BATCH_BITS_COUNT);
+      std::vector<uint64_t> xx(513);
+      #endif
+
+
+      // Words without vertices of the frontier are skipped by their summary bits
+      const size_t endWord = (limit+63)/64;
+      for(size_t w=frontier.summary->nextWord(startPerson>>6, endWord); w<endWord; w=frontier.summary->nextWord(w+1, endWord)) {
+         uint64_t candidates = frontier.summary->candidates(w, startPerson, limit);
+         while(candidates!=0) {
+            const PersonId curPerson = w*64+__builtin_ctzl(candidates);
+            candidates &= candidates-1;
+            auto curVisit = visitList[curPerson];
+
+            #ifdef DO_PREFETCH
+            if(curPerson+PREFETCH < limit) {
+               __builtin_prefetch(visitList + curPerson + PREFETCH,0);
+               // pref=(visitList + curPerson + PREFETCH)->data[0];
+            }
+            #endif
+
+            #ifdef TRACE
+            {
+               size_t bitsSet = 0;
+               for(int i=0; i<width; i++) {
+                  bitsSet += BitBaseOp<bit_t>::popCount(curVisit.data[i]);
+               }
+               numBitsSet[bitsSet]++;
+            }
+            #endif
+
+            bool zero=true;
+            for(int i=0; i<width; i++) {
+               if(BitBaseOp<bit_t>::notZero(curVisit.data[i])) {
+                  zero=false;
+                  break;
+               }
+            }
+            if(zero) {
+               continue;
+            }
+
+            auto friendsBounds = subgraph.neighbors(curPerson);
+            #ifdef DO_PREFETCH
+            const int p=min(PREFETCH, (unsigned int)(friendsBounds.second-friendsBounds.first));
+            for(int a=1; a<p; a++) {
+               __builtin_prefetch(nextVisitList + *(friendsBounds.first+a),1);
+               // pref=(nextVisitList + *(friendsBounds.first+a))->data[0];
+            }
+            #endif
+            for(unsigned i=0; i<width; i++) {
+               curVisit.data[i] &= processQuery.data[i];
+            }
+            while(friendsBounds.first != friendsBounds.second) {
+               #ifdef DO_PREFETCH
+               if(friendsBounds.first+PREFETCH < friendsBounds.second) {
+                  __builtin_prefetch(nextVisitList + *(friendsBounds.first+PREFETCH),1);
+                  // pref=(nextVisitList + *(friendsBounds.first+PREFETCH))->data[0];
+               }
+               #endif
+
+               #ifdef TRACE
+               {
+                  numFriendsAnalyzed++;
+                  size_t newBits = 0;
+                  for(unsigned i=0; i<width; i++) {
+                     newBits += BitBaseOp<bit_t>::popCount(nextVisitList[*friendsBounds.first].data[i] | curVisit.data[i])
+                        - BitBaseOp<bit_t>::popCount(nextVisitList[*friendsBounds.first].data[i] );
+                  }
+                  numNewSeen[newBits]++;
+               }
+               #endif
+
+               for(unsigned i=0; i<width; i++) {
+                  nextVisitList[*friendsBounds.first].data[i] |= curVisit.data[i];
+               }
+               ++friendsBounds.first;
+         }
+            for(unsigned i=0; i<width; i++) {
+               visitList[curPerson].data[i] = BitBaseOp<bit_t>::zero();
+            }
          }
       }
+      frontier.summary->clear();
 
       #ifdef BI_DIRECTIONAl
       uint32_t frontierSize = 0;
       uint64_t nextVisitNeighbors = 0;
       #endif
+      nextFrontier.clear();
       for (PersonId curPerson = 0; curPerson<limit; ++curPerson) {
-         #ifdef BI_DIRECTIONAl
          bool nextVisitNonzero=false;
-         #endif
          for(unsigned i=0; i<width; i++) {
             const bit_t nextVisit = nextVisitList[curPerson].data[i];
             if(BitBaseOp<bit_t>::notZero(nextVisit)) {
@@ -372,20 +831,22 @@ struct HugeBatchBfs {
                if(BitBaseOp<bit_t>::notZero(newVisits)) {
                   seen[curPerson].data[i] |= newVisits;
                   batchDist.updateDiscovered(newVisits, i);
-
-                  #ifdef BI_DIRECTIONAl
                   nextVisitNonzero = true;
-                  #endif
                }
             }
          }
-         #ifdef BI_DIRECTIONAl
          if(nextVisitNonzero) {
+            touched.add(curPerson);
+            nextFrontier.add(curPerson);
+            nextFrontier.summary->set(curPerson);
+            #ifdef BI_DIRECTIONAl
             frontierSize++;
-            nextVisitNeighbors += subgraph.retrieve(curPerson)->size();
+            nextVisitNeighbors += subgraph.degree(curPerson);
+            #endif
          }
-         #endif
       }
+      nextFrontier.finish(limit);
+      nextFrontier.summary->valid = true;
 
       #ifdef TRACE
       {
@@ -405,15 +866,24 @@ struct HugeBatchBfs {
       #endif
    }
 
-   static std::pair<uint32_t,uint64_t> __attribute__((hot)) runBatchRoundRev(const PersonSubgraph& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, BatchDistance<bit_t, width>& batchDist, const Bitset/* processQuery*/
+   template<typename GraphT>
+   static std::pair<uint32_t,uint64_t> __attribute__((hot)) runBatchRoundRev(const GraphT& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, DistanceT& batchDist, const Bitset processQuery, TouchedRange& touched, BatchTeam* team, const SparseFrontier& frontier, SparseFrontier& nextFrontier, VertexSummary& pending
       #if defined(STATISTICS)
       , BatchStatistics& statistics, uint32_t nextDistance
       #elif defined(TRACE)
       , uint32_t nextDistance
       #endif
    ) {
+      if(team!=nullptr) {
+         frontier.summary->clear();
+         nextFrontier.summary->valid = false;
+         pending.valid = false;
+         return runBatchRoundRevTeam(*team, subgraph, startPerson, limit, visitList, nextVisitList, seen, batchDist, processQuery, touched, nextFrontier);
+      }
+
       uint32_t frontierSize = 0;
       uint64_t nextVisitNeighbors = 0;
+      nextFrontier.clear();
 
          // volatile bit_t pref;
       #ifdef DO_PREFETCH
@@ -423,68 +893,106 @@ struct HugeBatchBfs {
       }
       #endif
 
-      for (PersonId curPerson = startPerson; curPerson<limit; ++curPerson) {
-         auto curSeen = seen[curPerson];
+      // Only vertices that miss active sources are checked, without a valid summary all vertices are.
+      // The summary is rebuilt from the vertices that are still missing sources after this round.
+      if(!pending.valid) {
+         pending.clear();
+      }
+      const size_t endWord = (limit+63)/64;
+      for(size_t w=pending.nextWord(startPerson>>6, endWord); w<endWord; w=pending.nextWord(w+1, endWord)) {
+         uint64_t candidates = pending.candidates(w, startPerson, limit);
+         uint64_t stillPending = 0;
+         while(candidates!=0) {
+            const PersonId curPerson = w*64+__builtin_ctzl(candidates);
+            candidates &= candidates-1;
+            auto curSeen = seen[curPerson];
 
-         #ifdef DO_PREFETCH
-         if(curPerson+PREFETCH < limit) {
-            __builtin_prefetch(seen + curPerson + PREFETCH,0);
-         }
-         #endif
+            #ifdef DO_PREFETCH
+            if(curPerson+PREFETCH < limit) {
+               __builtin_prefetch(seen + curPerson + PREFETCH,0);
+            }
+            #endif
 
-         bool zero=true;
-         for(int i=0; i<width; i++) {
-            if(BitBaseOp<bit_t>::notAllOnes(curSeen.data[i])) {
-               zero=false;
-               break;
+            // Active sources that have not reached this vertex yet
+            Bitset missing;
+            bool zero=true;
+            for(unsigned i=0; i<width; i++) {
+               missing.data[i] = BitBaseOp<bit_t>::andNot(processQuery.data[i], curSeen.data[i]);
+               if(BitBaseOp<bit_t>::notZero(missing.data[i])) {
+                  zero=false;
+               }
+            }
+            if(zero) {
+               continue;
             }
-         }
-         if(zero) {
-            continue;
-         }
 
-         const auto& curFriends=*subgraph.retrieve(curPerson);
-         auto friendsBounds = curFriends.bounds();
-         #ifdef DO_PREFETCH
-         const int p=min(PREFETCH, (unsigned int)(friendsBounds.second-friendsBounds.first));
-         for(int a=1; a<p; a++) {
-            __builtin_prefetch(visitList + *(friendsBounds.first+a),1);
-         }
-         #endif
-         Bitset nextVisit;
-         while(friendsBounds.first != friendsBounds.second) {
+            auto friendsBounds = subgraph.neighbors(curPerson);
             #ifdef DO_PREFETCH
-            if(friendsBounds.first+PREFETCH < friendsBounds.second) {
-               __builtin_prefetch(visitList + *(friendsBounds.first+PREFETCH),1);
+            const int p=min(PREFETCH, (unsigned int)(friendsBounds.second-friendsBounds.first));
+            for(int a=1; a<p; a++) {
+               __builtin_prefetch(visitList + *(friendsBounds.first+a),1);
             }
             #endif
+            Bitset nextVisit;
+            while(friendsBounds.first != friendsBounds.second) {
+               #ifdef DO_PREFETCH
+               if(friendsBounds.first+PREFETCH < friendsBounds.second) {
+                  __builtin_prefetch(visitList + *(friendsBounds.first+PREFETCH),1);
+               }
+               #endif
 
-            for(int i=0; i<width; i++) {
-               nextVisit.data[i] |= visitList[*friendsBounds.first].data[i];
+               // Stop scanning once all missing sources were found
+               bit_t remaining = BitBaseOp<bit_t>::zero();
+               for(unsigned i=0; i<width; i++) {
+                  nextVisit.data[i] |= visitList[*friendsBounds.first].data[i];
+                  remaining |= BitBaseOp<bit_t>::andNot(missing.data[i], nextVisit.data[i]);
+               }
+               ++friendsBounds.first;
+               if(BitBaseOp<bit_t>::isZero(remaining)) {
+                  break;
+               }
+            }
+            // Only missing sources discover the vertex, lanes of pruned sources still have visit bits
+            for(unsigned i=0; i<width; i++) {
+               nextVisit.data[i] &= missing.data[i];
             }
-            ++friendsBounds.first;
-         }
-         for(int i=0; i<width; i++) {
-            nextVisit.data[i] = BitBaseOp<bit_t>::andNot(nextVisit.data[i], curSeen.data[i]);
-         }
 
-         nextVisitList[curPerson] = nextVisit;
-         bool nextVisitNonzero=false;
-         for(int i=0; i<width; i++) {
-            if(BitBaseOp<bit_t>::notZero(nextVisit.data[i])) {
-               seen[curPerson].data[i] = curSeen.data[i] | nextVisit.data[i];
-               batchDist.updateDiscovered(nextVisit.data[i], i);
+            // Vertices still missing active sources are checked again in the next bottom-up round
+            bool stillMissing=false;
+            for(unsigned i=0; i<width; i++) {
+               stillMissing |= BitBaseOp<bit_t>::notZero(BitBaseOp<bit_t>::andNot(missing.data[i], nextVisit.data[i]));
+            }
+            if(stillMissing) {
+               stillPending |= 1ull<<(curPerson&63);
+            }
 
-               nextVisitNonzero=true;
+            nextVisitList[curPerson] = nextVisit;
+            bool nextVisitNonzero=false;
+            for(unsigned i=0; i<width; i++) {
+               if(BitBaseOp<bit_t>::notZero(nextVisit.data[i])) {
+                  seen[curPerson].data[i] = curSeen.data[i] | nextVisit.data[i];
+                  batchDist.updateDiscovered(nextVisit.data[i], i);
+
+                  nextVisitNonzero=true;
+               }
+            }
+            if(nextVisitNonzero) {
+               touched.add(curPerson);
+               nextFrontier.add(curPerson);
+               nextFrontier.summary->set(curPerson);
+               frontierSize++;
+               nextVisitNeighbors += subgraph.degree(curPerson);
             }
          }
-         if(nextVisitNonzero) {
-            frontierSize++;
-            nextVisitNeighbors += subgraph.retrieve(curPerson)->size();
-         }
+         pending.store(w, stillPending);
       }
+      pending.valid = true;
 
-      memset(visitList, 0, sizeof(Bitset) * limit);
+      // Only vertices seen so far can have visit bits set
+      memset(static_cast<void*>(visitList+touched.begin), 0, sizeof(Bitset)*(touched.end-touched.begin));
+      frontier.summary->clear();
+      nextFrontier.finish(limit);
+      nextFrontier.summary->valid = true;
 
       // for (PersonId curPerson = 0; curPerson<limit; ++curPerson) {
       //    for(unsigned i=0; i<width; i++) {
@@ -504,6 +1012,241 @@ struct HugeBatchBfs {
       return std::make_pair(frontierSize, nextVisitNeighbors);
    }
 
+   // Per member results of a round processed by a team
+   struct alignas(64) TeamMemberRound {
+      TouchedRange touched;
+      uint32_t frontierSize;
+      uint64_t nextVisitNeighbors;
+
+      TeamMemberRound() : frontierSize(0), nextVisitNeighbors(0) {
+      }
+   };
+
+   // Adds the discovery counts of a member to the counts of the batch
+   static void addMemberDistances(uint32_t* numDistDiscovered, const uint32_t* memberDistDiscovered) {
+      for(size_t pos=0; pos<BATCH_BITS_COUNT; pos++) {
+         if(memberDistDiscovered[pos]!=0) {
+            __atomic_fetch_add(numDistDiscovered+pos, memberDistDiscovered[pos], __ATOMIC_RELAXED);
+         }
+      }
+   }
+
+   // Merges the member results. The frontier ids of each chunk were written starting at the chunk
+   // begin, concatenating them in chunk order yields a sorted vertex list.
+   static std::pair<uint32_t,uint64_t> finishTeamRound(const std::vector<TeamMemberRound>& members, const TeamChunks& chunks, const std::vector<uint32_t>& chunkFrontierSizes, const PersonId limit, TouchedRange& touched, SparseFrontier& nextFrontier) {
+      uint32_t frontierSize = 0;
+      uint64_t nextVisitNeighbors = 0;
+      for(const auto& member : members) {
+         if(!member.touched.empty()) {
+            touched.add(member.touched.begin);
+            touched.add(member.touched.end-1);
+         }
+         frontierSize += member.frontierSize;
+         nextVisitNeighbors += member.nextVisitNeighbors;
+      }
+
+      nextFrontier.size = frontierSize;
+      if(frontierSize <= limit/SPARSE_FRONTIER) {
+         uint32_t pos = 0;
+         for(size_t chunk=0; chunk<chunkFrontierSizes.size(); chunk++) {
+            memmove(nextFrontier.ids+pos, nextFrontier.ids+chunks.chunkBegin(chunk), sizeof(PersonId)*chunkFrontierSizes[chunk]);
+            pos += chunkFrontierSizes[chunk];
+         }
+      }
+      nextFrontier.finish(limit);
+      return std::make_pair(frontierSize, nextVisitNeighbors);
+   }
+
+   // Dense top-down round processed by a team. Members expand chunks of the frontier and OR into the
+   // visit lists of arbitrary neighbors, so these writes are atomic. After the barrier each member
+   // computes the new visits of the vertices in its chunks.
+   template<typename GraphT>
+   static std::pair<uint32_t,uint64_t> runBatchRoundTeam(BatchTeam& team, const GraphT& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, DistanceT& batchDist, const Bitset processQuery, TouchedRange& touched, SparseFrontier& nextFrontier) {
+      TeamChunks expandChunks(startPerson, limit);
+      team.run([&](unsigned /*member*/) {
+         size_t chunk;
+         PersonId chunkBegin, chunkEnd;
+         while(expandChunks.next(chunk, chunkBegin, chunkEnd)) {
+            for (PersonId curPerson = chunkBegin; curPerson<chunkEnd; ++curPerson) {
+               auto curVisit = visitList[curPerson];
+
+               #ifdef DO_PREFETCH
+               if(curPerson+PREFETCH < chunkEnd) {
+                  __builtin_prefetch(visitList + curPerson + PREFETCH,0);
+               }
+               #endif
+
+               bool zero=true;
+               for(unsigned i=0; i<width; i++) {
+                  if(BitBaseOp<bit_t>::notZero(curVisit.data[i])) {
+                     zero=false;
+                     break;
+                  }
+               }
+               if(zero) {
+                  continue;
+               }
+
+               for(unsigned i=0; i<width; i++) {
+                  curVisit.data[i] &= processQuery.data[i];
+               }
+               auto friendsBounds = subgraph.neighbors(curPerson);
+               while(friendsBounds.first != friendsBounds.second) {
+                  #ifdef DO_PREFETCH
+                  if(friendsBounds.first+PREFETCH < friendsBounds.second) {
+                     __builtin_prefetch(nextVisitList + *(friendsBounds.first+PREFETCH),1);
+                  }
+                  #endif
+
+                  for(unsigned i=0; i<width; i++) {
+                     AtomicOrOp<bit_t>::atomicOr(nextVisitList[*friendsBounds.first].data[i], curVisit.data[i]);
+                  }
+                  ++friendsBounds.first;
+               }
+               for(unsigned i=0; i<width; i++) {
+                  visitList[curPerson].data[i] = BitBaseOp<bit_t>::zero();
+               }
+            }
+         }
+      });
+
+      TeamChunks collectChunks(0, limit);
+      std::vector<TeamMemberRound> members(team.size());
+      std::vector<uint32_t> chunkFrontierSizes(collectChunks.numChunks());
+      team.run([&](unsigned member) {
+         TeamMemberRound& round = members[member];
+         alignas(64) uint32_t memberDistDiscovered[BATCH_BITS_COUNT];
+         memset(memberDistDiscovered,0,BATCH_BITS_COUNT*sizeof(uint32_t));
+         DistanceT memberDist(memberDistDiscovered);
+
+         size_t chunk;
+         PersonId chunkBegin, chunkEnd;
+         while(collectChunks.next(chunk, chunkBegin, chunkEnd)) {
+            uint32_t chunkFrontierSize = 0;
+            for (PersonId curPerson = chunkBegin; curPerson<chunkEnd; ++curPerson) {
+               bool nextVisitNonzero=false;
+               for(unsigned i=0; i<width; i++) {
+                  const bit_t nextVisit = nextVisitList[curPerson].data[i];
+                  if(BitBaseOp<bit_t>::notZero(nextVisit)) {
+                     const bit_t newVisits = BitBaseOp<bit_t>::andNot(nextVisit, seen[curPerson].data[i]);
+                     nextVisitList[curPerson].data[i] = newVisits;
+                     if(BitBaseOp<bit_t>::notZero(newVisits)) {
+                        seen[curPerson].data[i] |= newVisits;
+                        memberDist.updateDiscovered(newVisits, i);
+                        nextVisitNonzero = true;
+                     }
+                  }
+               }
+               if(nextVisitNonzero) {
+                  round.touched.add(curPerson);
+                  nextFrontier.ids[chunkBegin+chunkFrontierSize++] = curPerson;
+                  round.nextVisitNeighbors += subgraph.degree(curPerson);
+               }
+            }
+            chunkFrontierSizes[chunk] = chunkFrontierSize;
+            round.frontierSize += chunkFrontierSize;
+         }
+
+         memberDist.finalize();
+         addMemberDistances(batchDist.numDistDiscovered, memberDistDiscovered);
+      });
+
+      return finishTeamRound(members, collectChunks, chunkFrontierSizes, limit, touched, nextFrontier);
+   }
+
+   // Bottom-up round processed by a team, each member only writes the bitsets of vertices in its chunks
+   template<typename GraphT>
+   static std::pair<uint32_t,uint64_t> runBatchRoundRevTeam(BatchTeam& team, const GraphT& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, DistanceT& batchDist, const Bitset processQuery, TouchedRange& touched, SparseFrontier& nextFrontier) {
+      TeamChunks chunks(startPerson, limit);
+      std::vector<TeamMemberRound> members(team.size());
+      std::vector<uint32_t> chunkFrontierSizes(chunks.numChunks());
+      team.run([&](unsigned member) {
+         TeamMemberRound& round = members[member];
+         alignas(64) uint32_t memberDistDiscovered[BATCH_BITS_COUNT];
+         memset(memberDistDiscovered,0,BATCH_BITS_COUNT*sizeof(uint32_t));
+         DistanceT memberDist(memberDistDiscovered);
+
+         size_t chunk;
+         PersonId chunkBegin, chunkEnd;
+         while(chunks.next(chunk, chunkBegin, chunkEnd)) {
+            uint32_t chunkFrontierSize = 0;
+            for (PersonId curPerson = chunkBegin; curPerson<chunkEnd; ++curPerson) {
+               auto curSeen = seen[curPerson];
+
+               #ifdef DO_PREFETCH
+               if(curPerson+PREFETCH < chunkEnd) {
+                  __builtin_prefetch(seen + curPerson + PREFETCH,0);
+               }
+               #endif
+
+               // Active sources that have not reached this vertex yet
+               Bitset missing;
+               bool zero=true;
+               for(unsigned i=0; i<width; i++) {
+                  missing.data[i] = BitBaseOp<bit_t>::andNot(processQuery.data[i], curSeen.data[i]);
+                  if(BitBaseOp<bit_t>::notZero(missing.data[i])) {
+                     zero=false;
+                  }
+               }
+               if(zero) {
+                  continue;
+               }
+
+               auto friendsBounds = subgraph.neighbors(curPerson);
+               Bitset nextVisit;
+               while(friendsBounds.first != friendsBounds.second) {
+                  #ifdef DO_PREFETCH
+                  if(friendsBounds.first+PREFETCH < friendsBounds.second) {
+                     __builtin_prefetch(visitList + *(friendsBounds.first+PREFETCH),0);
+                  }
+                  #endif
+
+                  // Stop scanning once all missing sources were found
+                  bit_t remaining = BitBaseOp<bit_t>::zero();
+                  for(unsigned i=0; i<width; i++) {
+                     nextVisit.data[i] |= visitList[*friendsBounds.first].data[i];
+                     remaining |= BitBaseOp<bit_t>::andNot(missing.data[i], nextVisit.data[i]);
+                  }
+                  ++friendsBounds.first;
+                  if(BitBaseOp<bit_t>::isZero(remaining)) {
+                     break;
+                  }
+               }
+               // Only missing sources discover the vertex, lanes of pruned sources still have visit bits
+               for(unsigned i=0; i<width; i++) {
+                  nextVisit.data[i] &= missing.data[i];
+               }
+
+               nextVisitList[curPerson] = nextVisit;
+               bool nextVisitNonzero=false;
+               for(unsigned i=0; i<width; i++) {
+                  if(BitBaseOp<bit_t>::notZero(nextVisit.data[i])) {
+                     seen[curPerson].data[i] = curSeen.data[i] | nextVisit.data[i];
+                     memberDist.updateDiscovered(nextVisit.data[i], i);
+                     nextVisitNonzero=true;
+                  }
+               }
+               if(nextVisitNonzero) {
+                  round.touched.add(curPerson);
+                  nextFrontier.ids[chunkBegin+chunkFrontierSize++] = curPerson;
+                  round.nextVisitNeighbors += subgraph.degree(curPerson);
+               }
+            }
+            chunkFrontierSizes[chunk] = chunkFrontierSize;
+            round.frontierSize += chunkFrontierSize;
+         }
+
+         memberDist.finalize();
+         addMemberDistances(batchDist.numDistDiscovered, memberDistDiscovered);
+      });
+
+      const auto frontierInfo = finishTeamRound(members, chunks, chunkFrontierSizes, limit, touched, nextFrontier);
+
+      // Only vertices seen so far can have visit bits set
+      memset(static_cast<void*>(visitList+touched.begin), 0, sizeof(Bitset)*(touched.end-touched.begin));
+      return frontierInfo;
+   }
+
    #else
 
    enum VisitAction : uint32_t { EMPTY, SINGLE, MULTI};
@@ -566,7 +1309,8 @@ struct HugeBatchBfs {
       }
    }
 
-   static void __attribute__((hot)) runBatchRound(const PersonSubgraph& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, BatchDistance<bit_t, width>& batchDist, const Bitset processQuery
+   template<typename GraphT>
+   static void __attribute__((hot)) runBatchRound(const GraphT& subgraph, const PersonId startPerson, const PersonId limit, Bitset* visitList, Bitset* nextVisitList, Bitset* __restrict__ seen, DistanceT& batchDist, const Bitset processQuery, TouchedRange& touched, BatchTeam* /*team*/, const SparseFrontier& /*frontier*/, SparseFrontier& /*nextFrontier*/
       #if defined(STATISTICS)
       , BatchStatistics& statistics, uint32_t nextDistance
       #elif defined(TRACE)
@@ -580,12 +1324,10 @@ struct HugeBatchBfs {
          // Skip persons with empty visit list
          if(visitResult.action == EMPTY) { continue; }
 
-         const auto& curFriends=*subgraph.retrieve(curPerson);
-
          //Only single person in this entry
          if(!detectSingle || visitResult.action == MULTI) {
             //More than one person
-            auto friendsBounds = curFriends.bounds();
+            auto friendsBounds = subgraph.neighbors(curPerson);
             #ifdef DO_PREFETCH
             __builtin_prefetch(seen + *(friendsBounds.first+1),0);
             __builtin_prefetch(nextVisitList + *(friendsBounds.first+1),1);
@@ -604,6 +1346,7 @@ struct HugeBatchBfs {
                   bit_t newVisits = BitBaseOp<bit_t>::andNot(visitResult.validVisit.data[i], seen[*friendsBounds.first].data[i]);
                   if(BitBaseOp<bit_t>::notZero(newVisits)) {
                      seen[*friendsBounds.first].data[i] |= visitResult.validVisit.data[i];
+                     touched.add(*friendsBounds.first);
                      nextVisitList[*friendsBounds.first].data[i] |= newVisits;
 
                      // Normal case until uint64_t
@@ -613,7 +1356,7 @@ struct HugeBatchBfs {
                ++friendsBounds.first;
             }
          } else {
-            auto friendsBounds = curFriends.bounds();
+            auto friendsBounds = subgraph.neighbors(curPerson);
             while(friendsBounds.first != friendsBounds.second) {
                #ifdef DO_PREFETCH
                if(friendsBounds.first+3 < friendsBounds.second) {
@@ -625,6 +1368,7 @@ struct HugeBatchBfs {
                bit_t newVisits = BitBaseOp<bit_t>::andNot(visitResult.validVisit.data[field], seen[*friendsBounds.first].data[field]);
                if(BitBaseOp<bit_t>::notZero(newVisits)) {
                   seen[*friendsBounds.first].data[field] |= visitResult.validVisit.data[field];
+                  touched.add(*friendsBounds.first);
                   nextVisitList[*friendsBounds.first].data[field] |= newVisits;
                   batchDist.numDistDiscovered[visitResult.queryId]++;
                }
@@ -638,6 +1382,11 @@ struct HugeBatchBfs {
 
    #endif
 
+   static bool isLaneActive(const Bitset& processQuery, const uint32_t pos) {
+      const auto field = pos/TYPE_BITS;
+      return BitBaseOp<bit_t>::notZero(processQuery.data[field] & BitBaseOp<bit_t>::getSetMask(pos-field*TYPE_BITS));
+   }
+
    static void updateProcessQuery(Bitset& processQuery, const uint32_t pos, const uint32_t numDiscovered,
        BatchBFSdata& bfsData, const uint32_t distance, uint32_t& queriesToProcess) {
       auto field = pos/Bitset::TYPE_BITS_COUNT;
@@ -0,0 +1,82 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include "base.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Query4 {
+
+   /// Threads that process the rounds of one batch BFS together with the thread running the batch.
+   /// The running thread is member 0, the helpers sleep between two calls of run.
+   /// The team size is configured by BATCH_THREADS (default 1, i.e., no team).
+   class BatchTeam {
+      std::vector<std::thread> helpers;
+      std::mutex mutex;
+      std::condition_variable workCondition;
+      std::condition_variable doneCondition;
+      const std::function<void(unsigned)>* job;
+      uint64_t generation;
+      unsigned numBusy;
+      bool shutdown;
+
+      void helperLoop(unsigned member);
+
+   public:
+      explicit BatchTeam(unsigned size);
+      ~BatchTeam();
+      BatchTeam(const BatchTeam&) = delete;
+      BatchTeam& operator=(const BatchTeam&) = delete;
+
+      unsigned size() const {
+         return helpers.size()+1;
+      }
+
+      /// Runs fn(member) on all members and returns once every member finished, so each call is a barrier
+      void run(const std::function<void(unsigned)>& fn);
+
+      /// Number of threads working on one batch
+      static unsigned teamSize();
+   };
+
+   /// Team of the calling thread, nullptr if batches are processed by a single thread
+   BatchTeam* getThreadLocalBatchTeam();
+
+   /// Hands out fixed size chunks of a vertex range to the members of a team
+   class TeamChunks {
+      const PersonId begin;
+      const PersonId end;
+      std::atomic<size_t> nextChunk;
+
+   public:
+      static const PersonId CHUNK_SIZE = 1024;
+
+      TeamChunks(PersonId begin, PersonId end) : begin(begin), end(end), nextChunk(0) {
+      }
+
+      size_t numChunks() const {
+         return end>begin ? (end-begin+CHUNK_SIZE-1)/CHUNK_SIZE : 0;
+      }
+
+      PersonId chunkBegin(size_t chunk) const {
+         return begin+chunk*CHUNK_SIZE;
+      }
+
+      /// Claims the next chunk, returns false once the range is exhausted
+      bool next(size_t& chunk, PersonId& chunkBeginOut, PersonId& chunkEndOut) {
+         chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+         if(chunk>=numChunks()) {
+            return false;
+         }
+         chunkBeginOut = chunkBegin(chunk);
+         chunkEndOut = std::min<PersonId>(chunkBeginOut+CHUNK_SIZE, end);
+         return true;
+      }
+   };
+}
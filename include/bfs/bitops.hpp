@@ -6,6 +6,8 @@
 #include "sse.hpp"
 #include <bitset>
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 
 template<typename bit_t>
 struct CtzlOp {
@@ -206,4 +208,90 @@ struct BitBaseOp<__m256i> {
       return _mm256_setzero_si256();
    }
 };
-#endif
\ No newline at end of file
+#endif
+#ifdef AVX512
+template<>
+struct CtzlOp<__m512i> {
+   static size_t ctzl(__m512i value) {
+      alignas(64) uint64_t parts[8];
+      _mm512_store_si512(parts, value);
+      for(unsigned i=0; i<7; i++) {
+         if(parts[i]!=0) {
+            return __builtin_ctzl(parts[i])+64*i;
+         }
+      }
+      return __builtin_ctzl(parts[7])+448;
+   }
+};
+
+template<>
+struct BitBaseOp<__m512i> {
+   static __m512i getSetMask(const size_t bitPos) {
+      return sseMasks512[bitPos];
+   }
+
+   // a & ~b as ternary logic, g++ 12 warns about the undefined pass-through register of _mm512_andnot_si512
+   static __m512i andNot(const __m512i a, const __m512i b) {
+      return _mm512_ternarylogic_epi64(a, b, b, 0x30);
+   }
+
+   static bool isZero(const __m512i value) {
+      return _mm512_test_epi64_mask(value, value)==0;
+   }
+
+   static bool notZero(const __m512i value) {
+      return _mm512_test_epi64_mask(value, value)!=0;
+   }
+
+   static bool notAllOnes(const __m512i value) {
+      return _mm512_cmpneq_epi64_mask(value, _mm512_set1_epi64(-1))!=0;
+   }
+
+   static unsigned popCount(const __m512i value) {
+      #ifdef __AVX512VPOPCNTDQ__
+      return _mm512_reduce_add_epi64(_mm512_popcnt_epi64(value));
+      #else
+      alignas(64) uint64_t parts[8];
+      _mm512_store_si512(parts, value);
+      unsigned count=0;
+      for(unsigned i=0; i<8; i++) {
+         count += __builtin_popcountl(parts[i]);
+      }
+      return count;
+      #endif
+   }
+
+   static inline __m512i zero() {
+      return _mm512_setzero_si512();
+   }
+};
+#endif
+
+// OR into a bitset that other threads write concurrently, bits that are already set are not written again
+template<typename bit_t, bool isIntegral=std::is_integral<bit_t>::value>
+struct AtomicOrOp {
+   static void atomicOr(bit_t& target, const bit_t value) {
+      const bit_t current = __atomic_load_n(&target, __ATOMIC_RELAXED);
+      if((current | value) != current) {
+         __atomic_fetch_or(&target, value, __ATOMIC_RELAXED);
+      }
+   }
+};
+
+// Vector registers are updated as independent 64 bit words
+template<typename bit_t>
+struct AtomicOrOp<bit_t, false> {
+   static const unsigned NUM_WORDS = sizeof(bit_t)/8;
+
+   static void atomicOr(bit_t& target, const bit_t value) {
+      uint64_t words[NUM_WORDS];
+      memcpy(words, &value, sizeof(bit_t));
+      uint64_t* targetWords = reinterpret_cast<uint64_t*>(&target);
+      for(unsigned w=0; w<NUM_WORDS; w++) {
+         const uint64_t current = __atomic_load_n(targetWords+w, __ATOMIC_RELAXED);
+         if((current | words[w]) != current) {
+            __atomic_fetch_or(targetWords+w, words[w], __ATOMIC_RELAXED);
+         }
+      }
+   }
+};
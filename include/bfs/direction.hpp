@@ -0,0 +1,128 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Query4 {
+
+   /// Chooses the direction of batch BFS rounds from measured round costs. For both directions the
+   /// policy learns the time per unit of work, per BFS level and overall. The first batches of a graph
+   /// use the fixed alpha/beta heuristic and probe the other direction next to the levels where the
+   /// heuristic switched, afterwards every round takes the direction with the lower predicted time.
+   /// DIRECTION_POLICY=static disables the model.
+   class DirectionPolicy {
+   public:
+      static const unsigned MAX_LEVELS = 32;
+      static const unsigned LEARN_BATCHES = 4;
+
+   private:
+      // Nanoseconds per unit of work as [topDown][level], 0 while there is no sample
+      double levelCost[2][MAX_LEVELS];
+      double directionCost[2];
+      uint64_t numBatches;
+      size_t numVertices;
+      uint64_t numEdges;
+      bool probedInBatch;
+
+      static unsigned levelIndex(uint32_t level) {
+         return level<MAX_LEVELS ? level : MAX_LEVELS-1;
+      }
+
+      double estimate(bool topDown, unsigned level) const {
+         const double cost = levelCost[topDown][level];
+         return cost>0 ? cost : directionCost[topDown];
+      }
+
+      bool sampled(bool topDown, unsigned level) const {
+         return levelCost[topDown][level]>0;
+      }
+
+      static void addSample(double& cost, double sample) {
+         cost = cost>0 ? 0.75*cost+0.25*sample : sample;
+      }
+
+   public:
+      DirectionPolicy() : numVertices(0), numEdges(0) {
+         reset();
+      }
+
+      void reset() {
+         for(unsigned d=0; d<2; d++) {
+            for(unsigned l=0; l<MAX_LEVELS; l++) {
+               levelCost[d][l] = 0;
+            }
+            directionCost[d] = 0;
+         }
+         numBatches = 0;
+         probedInBatch = false;
+      }
+
+      /// Starts a new batch, what was learned on another graph is dropped
+      void startBatch(size_t batchVertices, uint64_t batchEdges) {
+         if(batchVertices!=numVertices || batchEdges!=numEdges) {
+            reset();
+            numVertices = batchVertices;
+            numEdges = batchEdges;
+         }
+         probedInBatch = false;
+      }
+
+      void finishBatch() {
+         numBatches++;
+      }
+
+      /// Direction of the round discovering the given level, work is the estimated cost of each direction
+      bool chooseTopDown(uint32_t level, bool heuristicTopDown, uint64_t topDownWork, uint64_t bottomUpWork) {
+         if(!isAdaptive()) {
+            return heuristicTopDown;
+         }
+         const unsigned l = levelIndex(level);
+         if(numBatches<LEARN_BATCHES) {
+            // Probe the other direction once per batch, next to a level where it was already used
+            const bool other = !heuristicTopDown;
+            if(!probedInBatch && !sampled(other, l)
+               && ((l>0 && sampled(other, l-1)) || (l+1<MAX_LEVELS && sampled(other, l+1)))) {
+               probedInBatch = true;
+               return other;
+            }
+            return heuristicTopDown;
+         }
+         const double topDownCost = estimate(true, l);
+         const double bottomUpCost = estimate(false, l);
+         if(topDownCost==0 || bottomUpCost==0) {
+            return heuristicTopDown;
+         }
+         return topDownCost*topDownWork <= bottomUpCost*bottomUpWork;
+      }
+
+      void record(uint32_t level, bool topDown, uint64_t work, uint64_t nanos) {
+         if(work==0) {
+            return;
+         }
+         const double sample = double(nanos)/work;
+         addSample(levelCost[topDown][levelIndex(level)], sample);
+         addSample(directionCost[topDown], sample);
+      }
+
+      static uint64_t now() {
+         return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      }
+
+      /// False if DIRECTION_POLICY=static
+      static bool isAdaptive();
+   };
+
+   /// Policy of the calling thread, Tag separates kernels whose rounds have different costs
+   template<typename Tag>
+   DirectionPolicy& getThreadLocalDirectionPolicy() {
+      static __thread DirectionPolicy* policyPtr=nullptr;
+      if(policyPtr == nullptr) {
+         policyPtr = new DirectionPolicy();
+      }
+      return *policyPtr;
+   }
+}
@@ -9,8 +9,17 @@
 #define AVX2 1
 #endif
 
+// The 512 bit batch BFS needs byte arithmetic from AVX-512BW for its distance counting
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define AVX512 1
+#endif
+
 extern __m128i sseMasks[128];
 
 #ifdef AVX2
 extern __m256i sseMasks256[256];
-#endif
\ No newline at end of file
+#endif
+
+#ifdef AVX512
+extern __m512i sseMasks512[512];
+#endif
@@ -0,0 +1,35 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include "bench.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+/// The batch BFS kernels for wider vector extensions are compiled into separate objects
+/// (bench_avx2.cpp, bench_avx512.cpp) with the corresponding target flags. The rest of the
+/// binary only requires the base architecture, the kernels are selected at startup.
+namespace dispatch {
+   enum class VectorIsa : int { Sse=128, Avx2=256, Avx512=512 };
+
+   /// Widest vector extension supported by both the host and the kernels of this binary
+   inline VectorIsa detectVectorIsa() {
+      __builtin_cpu_init();
+      if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+         return VectorIsa::Avx512;
+      } else if(__builtin_cpu_supports("avx2")) {
+         return VectorIsa::Avx2;
+      }
+      return VectorIsa::Sse;
+   }
+
+   /// Creates the HugeBatchBfs bencher for the given register width, nullptr if the width is not instantiated
+   BFSBenchmark* createAvx2Bencher(const int batchWidth, const std::string& graphLayout, size_t& maxBatchSize, std::string& bfsType);
+   BFSBenchmark* createAvx512Bencher(const int batchWidth, const std::string& graphLayout, size_t& maxBatchSize, std::string& bfsType);
+
+   /// Adds the runBfs benchmarks of the extension
+   void addAvx2Benchmarks(std::vector<std::unique_ptr<BFSBenchmark>>& benchmarks);
+   void addAvx512Benchmarks(std::vector<std::unique_ptr<BFSBenchmark>>& benchmarks);
+}
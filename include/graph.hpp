@@ -4,16 +4,26 @@
 #pragma once
 
 #include "log.hpp"
+#include "macros.hpp"
 #include "queue.hpp"
+#include "io.hpp"
+#include "worker.hpp"
+#include "streamvbyte.hpp"
+#include "relabeling.hpp"
+#include "alloc.hpp"
 
 #include <cstdint>
 #include <cstddef>
+#include <cstdlib>
 #include <cassert>
+#include <cstring>
+#include <algorithm>
 #include <utility>
 #include <vector>
 #include <string>
 #include <limits>
-#include <unordered_map>
+#include <memory>
+#include <sys/mman.h>
 
 struct NodePair {
    uint64_t idA;
@@ -27,17 +37,79 @@ struct NodePair {
 
 struct GraphData {
    size_t numNodes;
-   std::vector<NodePair> edges;
-   std::unordered_map<uint64_t,uint64_t> revNodeRenaming;
+   // Undirected edges between dense ids as parsed per file chunk, may contain duplicates
+   std::vector<std::vector<NodePair>> edgeChunks;
+   std::vector<uint64_t> revNodeRenaming;
 
-   GraphData(const size_t numNodes, std::vector<NodePair> edges, std::unordered_map<uint64_t,uint64_t> revNodeRenaming)
-      : numNodes(numNodes), edges(move(edges)), revNodeRenaming(std::move(revNodeRenaming)) {
+   GraphData(const size_t numNodes, std::vector<std::vector<NodePair>> edgeChunks, std::vector<uint64_t> revNodeRenaming)
+      : numNodes(numNodes), edgeChunks(move(edgeChunks)), revNodeRenaming(std::move(revNodeRenaming)) {
    }
 
    GraphData(GraphData& other) = delete;
    GraphData(GraphData&& other) = default;
 
-   static GraphData loadFromPath(const std::string& edgesFile);
+   static GraphData loadFromPath(const std::string& edgesFile, Workers& workers);
+
+   /// Replaces the external ids of the edges with dense ids.
+   /// Returns the sorted unique external ids, i.e., the mapping from dense to external id.
+   static std::vector<uint64_t> renameNodes(std::vector<std::vector<NodePair>>& edgeChunks, Workers& workers);
+};
+
+/// Header of the binary graph snapshot. All sections are 64 byte aligned,
+/// positions are byte offsets from the start of the file.
+struct GraphSnapshotHeader {
+   static const uint32_t currentVersion = 2;
+   static const char magicValue[8];
+
+   char magic[8];
+   uint32_t version;
+   uint32_t idSize;
+   uint64_t numVertices;
+   uint64_t numEdges;
+   uint64_t numComponents; // Including the invalid component 0
+   uint64_t maxComponentSize;
+   uint64_t offsetsPos; // uint64_t[numVertices], entry offset of each vertex' SizedList
+   uint64_t dataPos; // SizedList blob
+   uint64_t dataSize;
+   uint64_t componentsPos; // ComponentId[numVertices]
+   uint64_t componentSizesPos; // ComponentSize[numComponents]
+   uint64_t componentEdgeCountPos; // ComponentSize[numComponents]
+   uint64_t renamingPos; // uint64_t[numVertices], internal to external node id
+   char relabeling[16]; // GRAPH_RELABELING that produced the vertex order
+
+   /// Checks whether the mapped data starts with a snapshot header
+   static bool isSnapshot(const void* mapping, size_t size);
+   /// Path of the snapshot that caches the given edges file
+   static std::string cachePath(const std::string& edgesFile);
+   /// Returns true if the cache snapshot exists, is newer than the edges file and was written
+   /// with the current version and GRAPH_RELABELING
+   static bool hasValidCache(const std::string& edgesFile);
+
+   /// Aborts if the header does not describe a valid snapshot of the given file size. Has to be
+   /// called on the mapped file, the adjacency list offsets are checked as well.
+   void validate(size_t fileSize, size_t expectedIdSize) const;
+
+private:
+   /// Checks without overflow that count elements starting at pos are within the file
+   static bool sectionFits(uint64_t pos, uint64_t count, uint64_t elementSize, size_t fileSize);
+};
+
+/// Writes the sections of a graph snapshot, the header is written on finish
+class GraphSnapshotWriter {
+   int fd;
+   uint64_t pos;
+   const std::string path;
+
+public:
+   GraphSnapshotHeader header;
+
+   GraphSnapshotWriter(const std::string& path);
+   GraphSnapshotWriter(const GraphSnapshotWriter&) = delete;
+   ~GraphSnapshotWriter();
+
+   /// Appends a 64 byte aligned section and returns its position
+   uint64_t writeSection(const void* data, size_t size);
+   void finish();
 };
 
 template<class EntryType>
@@ -108,39 +180,45 @@ public:
 private:
    Content* table;
 
-   std::unordered_map<uint64_t,uint64_t> revNodeRenaming;
+   std::vector<uint64_t> revNodeRenaming;
+
+   // Set if the graph data is backed by a mapped snapshot
+   std::unique_ptr<io::MmapedFile> snapshot;
+   // Allocated size of data, may exceed dataSize
+   size_t dataCapacity;
 
 public:
    uint8_t* data;
+   size_t dataSize;
 
-   Graph(size_t numVertices) : numVertices(numVertices), personComponents(numVertices), componentSizes(), componentEdgeCount(), maxComponentSize(), table(nullptr), data(nullptr) {
-      // XXX: Maybe posix_memalign helps?
-      table = new Content[numVertices]();
+   Graph(size_t numVertices) : numVertices(numVertices), personComponents(numVertices), componentSizes(), componentEdgeCount(), maxComponentSize(), table(nullptr), dataCapacity(0), data(nullptr), dataSize(0) {
+      table = mem::allocateArray<Content>(numVertices);
    }
 
    Graph(Graph& other) = delete;
 
-   Graph(Graph&& other) : numVertices(other.numVertices), numEdges(other.numEdges), personComponents(other.personComponents), componentSizes(other.componentSizes), componentEdgeCount(other.componentEdgeCount), maxComponentSize(other.maxComponentSize), table(other.table), revNodeRenaming(std::move(other.revNodeRenaming)), data(other.data) {
+   Graph(Graph&& other) : numVertices(other.numVertices), numEdges(other.numEdges), personComponents(other.personComponents), componentSizes(other.componentSizes), componentEdgeCount(other.componentEdgeCount), maxComponentSize(other.maxComponentSize), table(other.table), revNodeRenaming(std::move(other.revNodeRenaming)), snapshot(std::move(other.snapshot)), dataCapacity(other.dataCapacity), data(other.data), dataSize(other.dataSize) {
       other.table=nullptr;
       other.data=nullptr;
    }
 
    ~Graph() {
       if(table) {
-         delete[] table;
+         mem::releaseArray(table, numVertices);
          table = nullptr;
       }
 
       if(data) {
-         delete[] data;
+         if(!snapshot) {
+            mem::release(data, dataCapacity);
+         }
          data = nullptr;
       }
    }
 
-   IdType mapInternalNodeId(IdType id) const {
-      const auto iter = revNodeRenaming.find(id);
-      if(iter!=revNodeRenaming.cend()) {
-         return iter->second;
+   uint64_t mapInternalNodeId(IdType id) const {
+      if(id<revNodeRenaming.size()) {
+         return revNodeRenaming[id];
       } else {
          throw -1;
       }
@@ -160,6 +238,20 @@ public:
       return table[id];
    }
 
+   /// Neighbours of the specified id as [begin, end) range
+   inline std::pair<const Id*,const Id* const> neighbors(Id id) const __attribute__ ((pure)) {
+      return retrieve(id)->bounds();
+   }
+
+   inline Id degree(Id id) const __attribute__ ((pure)) {
+      return retrieve(id)->size();
+   }
+
+   /// Mapping from internal to external node id
+   const std::vector<uint64_t>& nodeRenaming() const {
+      return revNodeRenaming;
+   }
+
    inline IdType maxKey() const {
       return numVertices-1;
    }
@@ -168,55 +260,264 @@ public:
       return numVertices;
    }
 
-   static Graph loadFromPath(const std::string& edgesFile) {
-      GraphData graphData = GraphData::loadFromPath(edgesFile);
-      IdType numPersons = graphData.numNodes;
-      std::vector<NodePair>& edges = graphData.edges;
+   static Graph loadFromPath(const std::string& edgesFile, Workers& workers) {
+      if(GraphSnapshotHeader::hasValidCache(edgesFile)) {
+         return loadFromSnapshot(GraphSnapshotHeader::cachePath(edgesFile));
+      }
+      {
+         io::MmapedFile file(edgesFile, O_RDONLY);
+         if(GraphSnapshotHeader::isSnapshot(file.mapping, file.size)) {
+            return loadFromSnapshot(edgesFile);
+         }
+      }
+
+      GraphData graphData = GraphData::loadFromPath(edgesFile, workers);
+      Graph personGraph = buildFromEdges(graphData, workers);
+
+      LOG_PRINT("[LOADING] Created person graph of size: "<< personGraph.dataSize/1024<<" kb");
+
+      #ifdef DEBUG
+      uint64_t retrievableFriends = 0;
+      for(IdType person=0; person<personGraph.size(); person++) {
+         retrievableFriends += personGraph.retrieve(person)->size();
+      }
+      assert(retrievableFriends==personGraph.numEdges);
+      #endif
+
+      personGraph.analyzeGraph();
+
+      const std::vector<IdType> newIds = relabelingFromEnv<IdType>(personGraph);
+      if(!newIds.empty()) {
+         personGraph.relabel(newIds, workers);
+      }
+
+      if(getenv("WRITE_GRAPH_SNAPSHOT")!=nullptr) {
+         personGraph.writeSnapshot(GraphSnapshotHeader::cachePath(edgesFile));
+      }
+
+      return personGraph;
+   }
+
+   /// Builds the adjacency lists in two passes over the edges: count degrees, then
+   /// scatter both directions into place. Lists are sorted and deduplicated afterwards,
+   /// so no doubled or sorted copy of the edge list is ever materialized.
+   static Graph buildFromEdges(GraphData& graphData, Workers& workers) {
+      const size_t numPersons = graphData.numNodes;
+      if(numPersons>std::numeric_limits<IdType>::max()) {
+         FATAL_ERROR("[LOADING] Too many nodes for id type: "<<numPersons);
+      }
+      auto& edgeChunks = graphData.edgeChunks;
 
-      // Build graph
       Graph personGraph(numPersons);
       personGraph.revNodeRenaming = std::move(graphData.revNodeRenaming);
-      const size_t dataSize = (numPersons+edges.size())*sizeof(IdType);
-      uint8_t* data = new uint8_t[dataSize]();
+
+      // Count degrees
+      size_t numEntries = numPersons;
       {
-         SizedList<IdType>* neighbours = reinterpret_cast<SizedList<IdType>*>(data);
-         size_t ix=0;
+         std::vector<IdType> degrees(numPersons);
+         std::vector<Task> countTasks;
+         for(auto& chunk : edgeChunks) {
+            countTasks.push_back(LambdaRunner::createLambdaTask([&degrees, &chunk] {
+               for(const NodePair& edge : chunk) {
+                  __sync_fetch_and_add(&degrees[edge.idA], 1);
+                  __sync_fetch_and_add(&degrees[edge.idB], 1);
+               }
+            }));
+         }
+         workers.runAll(std::move(countTasks));
+
          for(IdType person=0; person<numPersons; person++) {
-            assert(reinterpret_cast<uint8_t*>(neighbours)<data+dataSize);
-            IdType* insertPtr = neighbours->getPtr(0);
-            IdType count=0;
-            while(ix<edges.size() && edges[ix].idA==person) {
-               *insertPtr = edges[ix].idB;
-               insertPtr++;
-               count++;
-               ix++;
-            }
+            numEntries += degrees[person];
+         }
 
-            neighbours->setSize(count);
+         // Allocate zeroed lists, their sizes are used as insert positions while scattering.
+         // Pages are first touched by the parallel scatter below.
+         personGraph.dataSize = numEntries*sizeof(IdType);
+         personGraph.dataCapacity = personGraph.dataSize;
+         personGraph.data = mem::allocateArray<uint8_t>(personGraph.dataSize);
+         SizedList<IdType>* neighbours = reinterpret_cast<SizedList<IdType>*>(personGraph.data);
+         for(IdType person=0; person<numPersons; person++) {
             personGraph.insert(person, neighbours);
-            neighbours = neighbours->nextList(count);
+            neighbours = neighbours->nextList(degrees[person]);
          }
       }
 
-      personGraph.data = data;
-      personGraph.numEdges = edges.size();
-
-      LOG_PRINT("[LOADING] Created person graph of size: "<< dataSize/1024<<" kb");
+      // Scatter neighbours
+      std::vector<Task> scatterTasks;
+      for(auto& chunk : edgeChunks) {
+         scatterTasks.push_back(LambdaRunner::createLambdaTask([&personGraph, &chunk] {
+            for(const NodePair& edge : chunk) {
+               personGraph.appendNeighbour(edge.idA, edge.idB);
+               personGraph.appendNeighbour(edge.idB, edge.idA);
+            }
+            std::vector<NodePair>().swap(chunk);
+         }));
+      }
+      workers.runAll(std::move(scatterTasks));
+      edgeChunks.clear();
+
+      // Sort and remove duplicate edges per list
+      workers.runRanges(numPersons, [&personGraph](size_t begin, size_t end) {
+         for(size_t person=begin; person<end; person++) {
+            SizedList<IdType>* neighbours = personGraph.table[person];
+            IdType* first = neighbours->getPtr(0);
+            IdType* last = neighbours->getPtr(neighbours->size());
+            std::sort(first, last);
+            neighbours->setSize(std::unique(first, last)-first);
+         }
+      });
 
-      #ifdef DEBUG
-      uint64_t retrievableFriends = 0;
+      personGraph.numEdges = 0;
       for(IdType person=0; person<numPersons; person++) {
-         retrievableFriends += personGraph.retrieve(person)->size();
+         personGraph.numEdges += personGraph.table[person]->size();
       }
-      assert(retrievableFriends==edges.size());
-      #endif
 
-      personGraph.analyzeGraph();
+      // Close gaps left by removed duplicates, lists only move towards the front
+      if(numPersons+personGraph.numEdges<numEntries) {
+         SizedList<IdType>* target = reinterpret_cast<SizedList<IdType>*>(personGraph.data);
+         for(IdType person=0; person<numPersons; person++) {
+            const IdType count = personGraph.table[person]->size();
+            if(target!=personGraph.table[person]) {
+               memmove(target, personGraph.table[person], sizeof(IdType)*(count+1));
+               personGraph.table[person] = target;
+            }
+            target = target->nextList(count);
+         }
+         personGraph.dataSize = (numPersons+personGraph.numEdges)*sizeof(IdType);
+      }
+
+      return personGraph;
+   }
+
+   /// Renumbers all vertices, newIds maps each current id to its new id. The neighbour lists,
+   /// the component assignment and the mapping to external ids are permuted accordingly.
+   void relabel(const std::vector<IdType>& newIds, Workers& workers) {
+      assert(newIds.size()==numVertices);
+      std::vector<IdType> oldIds(numVertices);
+      for(IdType person=0; person<numVertices; person++) {
+         oldIds[newIds[person]] = person;
+      }
+
+      // Lists keep their sizes, so the new positions follow from the degrees in new order
+      uint8_t* newData = mem::allocateArray<uint8_t>(dataSize);
+      Content* newTable = mem::allocateArray<Content>(numVertices);
+      SizedList<IdType>* neighbours = reinterpret_cast<SizedList<IdType>*>(newData);
+      for(IdType person=0; person<numVertices; person++) {
+         newTable[person] = neighbours;
+         neighbours = neighbours->nextList(degree(oldIds[person]));
+      }
 
-      return std::move(personGraph);      
+      workers.runRanges(numVertices, [this, &newIds, &oldIds, newTable](size_t begin, size_t end) {
+         for(size_t person=begin; person<end; person++) {
+            const auto bounds = neighbors(oldIds[person]);
+            SizedList<IdType>* target = newTable[person];
+            target->setSize(bounds.second-bounds.first);
+            IdType* targetIter = target->getPtr(0);
+            for(auto iter=bounds.first; iter!=bounds.second; ++iter) {
+               *targetIter++ = newIds[*iter];
+            }
+            std::sort(target->getPtr(0), targetIter);
+         }
+      });
+
+      if(!snapshot) {
+         mem::release(data, dataCapacity);
+      }
+      snapshot.reset();
+      data = newData;
+      dataCapacity = dataSize;
+      mem::releaseArray(table, numVertices);
+      table = newTable;
+
+      std::vector<ComponentId> newComponents(numVertices);
+      std::vector<uint64_t> newRenaming(numVertices);
+      for(IdType person=0; person<numVertices; person++) {
+         newComponents[person] = personComponents[oldIds[person]];
+         newRenaming[person] = revNodeRenaming[oldIds[person]];
+      }
+      personComponents.swap(newComponents);
+      revNodeRenaming.swap(newRenaming);
+   }
+
+   /// Opens a graph snapshot, the adjacency data is used directly from the mapping
+   static Graph loadFromSnapshot(const std::string& snapshotFile) {
+      LOG_PRINT("[LOADING] Loading graph snapshot: "<< snapshotFile);
+      std::unique_ptr<io::MmapedFile> file(new io::MmapedFile(snapshotFile, O_RDONLY));
+      madvise(file->mapping, file->size, MADV_WILLNEED);
+
+      const uint8_t* base = reinterpret_cast<const uint8_t*>(file->mapping);
+      const GraphSnapshotHeader& header = *reinterpret_cast<const GraphSnapshotHeader*>(base);
+      header.validate(file->size, sizeof(IdType));
+
+      Graph personGraph(header.numVertices);
+      personGraph.numEdges = header.numEdges;
+      personGraph.maxComponentSize = header.maxComponentSize;
+      personGraph.data = const_cast<uint8_t*>(base+header.dataPos);
+      personGraph.dataSize = header.dataSize;
+
+      const uint64_t* offsets = reinterpret_cast<const uint64_t*>(base+header.offsetsPos);
+      IdType* entries = reinterpret_cast<IdType*>(personGraph.data);
+      for(size_t person=0; person<header.numVertices; person++) {
+         personGraph.table[person] = reinterpret_cast<Content>(entries+offsets[person]);
+      }
+
+      const ComponentId* components = reinterpret_cast<const ComponentId*>(base+header.componentsPos);
+      personGraph.personComponents.assign(components, components+header.numVertices);
+      const ComponentSize* componentSizes = reinterpret_cast<const ComponentSize*>(base+header.componentSizesPos);
+      personGraph.componentSizes.assign(componentSizes, componentSizes+header.numComponents);
+      const ComponentSize* componentEdgeCount = reinterpret_cast<const ComponentSize*>(base+header.componentEdgeCountPos);
+      personGraph.componentEdgeCount.assign(componentEdgeCount, componentEdgeCount+header.numComponents);
+
+      const uint64_t* renaming = reinterpret_cast<const uint64_t*>(base+header.renamingPos);
+      personGraph.revNodeRenaming.assign(renaming, renaming+header.numVertices);
+
+      personGraph.snapshot = std::move(file);
+
+      LOG_PRINT("[LOADING] Mapped person graph of size: "<< header.dataSize/1024<<" kb");
+      std::cout<<"# Found number components "<< header.numComponents-1<<" (from snapshot)."<<std::endl;
+
+      return personGraph;
+   }
+
+   /// Writes the graph including its component analysis as binary snapshot
+   void writeSnapshot(const std::string& snapshotFile) const {
+      LOG_PRINT("[LOADING] Writing graph snapshot: "<< snapshotFile);
+      GraphSnapshotWriter writer(snapshotFile);
+      GraphSnapshotHeader& header = writer.header;
+      header.idSize = sizeof(IdType);
+      header.numVertices = numVertices;
+      header.numEdges = numEdges;
+      header.numComponents = componentSizes.size();
+      header.maxComponentSize = maxComponentSize;
+      const std::string relabeling = relabelingNameFromEnv();
+      if(relabeling.size()>=sizeof(header.relabeling)) {
+         FATAL_ERROR("[LOADING] Relabeling name too long for the graph snapshot: "<<relabeling);
+      }
+      // The header is zeroed, so the name stays terminated
+      memcpy(header.relabeling, relabeling.data(), relabeling.size());
+
+      std::vector<uint64_t> offsets(numVertices);
+      for(size_t person=0; person<numVertices; person++) {
+         offsets[person] = reinterpret_cast<const IdType*>(table[person])-reinterpret_cast<const IdType*>(data);
+      }
+      header.offsetsPos = writer.writeSection(offsets.data(), offsets.size()*sizeof(uint64_t));
+      header.dataPos = writer.writeSection(data, dataSize);
+      header.dataSize = dataSize;
+      header.componentsPos = writer.writeSection(personComponents.data(), personComponents.size()*sizeof(ComponentId));
+      header.componentSizesPos = writer.writeSection(componentSizes.data(), componentSizes.size()*sizeof(ComponentSize));
+      header.componentEdgeCountPos = writer.writeSection(componentEdgeCount.data(), componentEdgeCount.size()*sizeof(ComponentSize));
+      header.renamingPos = writer.writeSection(revNodeRenaming.data(), revNodeRenaming.size()*sizeof(uint64_t));
+      writer.finish();
    }
 
 private:
+   /// Appends a neighbour to a list, safe to call concurrently
+   void appendNeighbour(Id id, Id neighbour) {
+      SizedList<IdType>* neighbours = table[id];
+      const IdType pos = __sync_fetch_and_add(&neighbours->size(), 1);
+      *neighbours->getPtr(pos) = neighbour;
+   }
+
    void analyzeGraph() {
       const auto graphSize = size();
 
@@ -276,4 +577,183 @@ private:
       LOG_PRINT("[Query4] Max component size "<< maxComponentSize);
       std::cout<<"# Found number components "<< componentId-1<<" ("<<trivialComponents<<" are of size < 5)."<<std::endl;
    }
-};
\ No newline at end of file
+};
+
+/// Adjacency in plain CSR layout: neighbours of vertex v are neighbourData[offsets[v], offsets[v+1]).
+/// Compared to the SizedList layout this saves the pointer indirection through the table and the
+/// inline size, the degree is derived from two adjacent offsets.
+template<class IdType>
+class CsrGraph {
+public:
+   typedef IdType Id;
+
+   typedef typename Graph<IdType>::ComponentId ComponentId;
+   typedef typename Graph<IdType>::ComponentSize ComponentSize;
+
+   const size_t numVertices;
+   size_t numEdges;
+
+   std::vector<ComponentId> personComponents;
+   std::vector<ComponentSize> componentSizes;
+   std::vector<ComponentSize> componentEdgeCount;
+   ComponentSize maxComponentSize;
+
+private:
+   std::vector<uint64_t, mem::Allocator<uint64_t>> offsets;
+   std::vector<IdType, mem::Allocator<IdType>> neighbourData;
+
+   std::vector<uint64_t> revNodeRenaming;
+
+public:
+   /// Converts a graph from the SizedList layout, neighbour order is preserved
+   explicit CsrGraph(const Graph<IdType>& graph)
+      : numVertices(graph.numVertices), numEdges(graph.numEdges), personComponents(graph.personComponents),
+        componentSizes(graph.componentSizes), componentEdgeCount(graph.componentEdgeCount), maxComponentSize(graph.maxComponentSize),
+        offsets(graph.numVertices+1), neighbourData(graph.numEdges), revNodeRenaming(graph.nodeRenaming()) {
+      uint64_t offset = 0;
+      for(size_t person=0; person<numVertices; person++) {
+         offsets[person] = offset;
+         const auto bounds = graph.neighbors(person);
+         std::copy(bounds.first, bounds.second, neighbourData.begin()+offset);
+         offset += bounds.second-bounds.first;
+      }
+      offsets[numVertices] = offset;
+      assert(offset==numEdges);
+   }
+
+   CsrGraph(const CsrGraph& other) = delete;
+   CsrGraph(CsrGraph&& other) = default;
+
+   uint64_t mapInternalNodeId(IdType id) const {
+      if(id<revNodeRenaming.size()) {
+         return revNodeRenaming[id];
+      } else {
+         throw -1;
+      }
+   }
+
+   /// Neighbours of the specified id as [begin, end) range
+   inline std::pair<const Id*,const Id* const> neighbors(Id id) const __attribute__ ((pure)) {
+      assert(id<numVertices);
+      const IdType* base = neighbourData.data();
+      return std::make_pair(base+offsets[id], base+offsets[id+1]);
+   }
+
+   inline Id degree(Id id) const __attribute__ ((pure)) {
+      assert(id<numVertices);
+      return offsets[id+1]-offsets[id];
+   }
+
+   const std::vector<uint64_t>& nodeRenaming() const {
+      return revNodeRenaming;
+   }
+
+   inline IdType maxKey() const {
+      return numVertices-1;
+   }
+
+   inline IdType size() const {
+      return numVertices;
+   }
+};
+
+/// Adjacency compressed with Stream VByte delta coding. Social graphs have many small id
+/// gaps, so most neighbours take one or two bytes instead of four. neighbors() decodes
+/// into a thread local buffer which stays valid until the next call on the same thread.
+template<class IdType>
+class CompressedGraph {
+   static_assert(sizeof(IdType)==sizeof(uint32_t), "Stream VByte coding requires 32 bit ids");
+
+public:
+   typedef IdType Id;
+
+   typedef typename Graph<IdType>::ComponentId ComponentId;
+   typedef typename Graph<IdType>::ComponentSize ComponentSize;
+
+   const size_t numVertices;
+   size_t numEdges;
+
+   std::vector<ComponentId> personComponents;
+   std::vector<ComponentSize> componentSizes;
+   std::vector<ComponentSize> componentEdgeCount;
+   ComponentSize maxComponentSize;
+
+private:
+   std::vector<uint64_t> offsets;
+   std::vector<IdType> degrees;
+   std::vector<uint8_t> encoded;
+
+   std::vector<uint64_t> revNodeRenaming;
+
+   static IdType* decodeBuffer(size_t count) {
+      static __thread IdType* buffer = nullptr;
+      static __thread size_t capacity = 0;
+      // The decoder always writes groups of four values
+      const size_t required = (count+3)/4*4;
+      if(required>capacity) {
+         free(buffer);
+         capacity = std::max(required, capacity*2);
+         const auto ret = posix_memalign(reinterpret_cast<void**>(&buffer), 64, capacity*sizeof(IdType));
+         if(unlikely(ret!=0)) {
+            throw -1;
+         }
+      }
+      return buffer;
+   }
+
+public:
+   /// Encodes a graph from the SizedList layout, neighbour lists have to be sorted
+   explicit CompressedGraph(const Graph<IdType>& graph)
+      : numVertices(graph.numVertices), numEdges(graph.numEdges), personComponents(graph.personComponents),
+        componentSizes(graph.componentSizes), componentEdgeCount(graph.componentEdgeCount), maxComponentSize(graph.maxComponentSize),
+        offsets(graph.numVertices), degrees(graph.numVertices), revNodeRenaming(graph.nodeRenaming()) {
+      encoded.reserve(graph.numEdges*2);
+      for(size_t person=0; person<numVertices; person++) {
+         const auto bounds = graph.neighbors(person);
+         assert(std::is_sorted(bounds.first, bounds.second));
+         offsets[person] = encoded.size();
+         degrees[person] = bounds.second-bounds.first;
+         streamvbyte::encodeSorted(bounds.first, degrees[person], encoded);
+      }
+      encoded.resize(encoded.size()+streamvbyte::decodePadding);
+      encoded.shrink_to_fit();
+      LOG_PRINT("[LOADING] Compressed neighbour lists from "<< numEdges*sizeof(IdType)/1024<<" kb to "<< encoded.size()/1024<<" kb");
+   }
+
+   CompressedGraph(const CompressedGraph& other) = delete;
+   CompressedGraph(CompressedGraph&& other) = default;
+
+   uint64_t mapInternalNodeId(IdType id) const {
+      if(id<revNodeRenaming.size()) {
+         return revNodeRenaming[id];
+      } else {
+         throw -1;
+      }
+   }
+
+   /// Neighbours of the specified id as [begin, end) range, see class comment for lifetime
+   inline std::pair<const Id*,const Id* const> neighbors(Id id) const {
+      assert(id<numVertices);
+      const IdType count = degrees[id];
+      IdType* buffer = decodeBuffer(count);
+      streamvbyte::decodeSorted(encoded.data()+offsets[id], count, buffer);
+      return std::make_pair(buffer, buffer+count);
+   }
+
+   inline Id degree(Id id) const __attribute__ ((pure)) {
+      assert(id<numVertices);
+      return degrees[id];
+   }
+
+   const std::vector<uint64_t>& nodeRenaming() const {
+      return revNodeRenaming;
+   }
+
+   inline IdType maxKey() const {
+      return numVertices-1;
+   }
+
+   inline IdType size() const {
+      return numVertices;
+   }
+};
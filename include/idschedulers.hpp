@@ -12,7 +12,8 @@
 #include <queue>
 
 struct RandomNodeOrdering {
-   static void order(std::vector<Query4::PersonId>& ids, size_t /*batchSize*/, const Query4::PersonSubgraph& /*subgraph*/) {
+   template<typename GraphT>
+   static void order(std::vector<Query4::PersonId>& ids, size_t /*batchSize*/, const GraphT& /*subgraph*/) {
       // Deterministic shuffeling
       std::random_device rd;
       std::mt19937 g(rd());
@@ -22,7 +23,8 @@ struct RandomNodeOrdering {
 };
 
 struct ComponentOrdering {
-   static void order(std::vector<Query4::PersonId>& ids, size_t maxBfs, size_t /*batchSize*/, const Query4::PersonSubgraph& subgraph) {
+   template<typename GraphT>
+   static void order(std::vector<Query4::PersonId>& ids, size_t maxBfs, size_t /*batchSize*/, const GraphT& subgraph) {
       if(maxBfs>ids.size()) {
          maxBfs=ids.size();
       }
@@ -34,29 +36,32 @@ struct ComponentOrdering {
 };
 
 struct DegreeOrdering {
-   static void order(std::vector<Query4::PersonId>& ids, size_t maxBfs, size_t /*batchSize*/, const Query4::PersonSubgraph& subgraph) {
+   template<typename GraphT>
+   static void order(std::vector<Query4::PersonId>& ids, size_t maxBfs, size_t /*batchSize*/, const GraphT& subgraph) {
       if(maxBfs>ids.size()) {
          maxBfs=ids.size();
       }
       // Sort by degree
       std::sort(ids.begin(), ids.begin()+maxBfs, [&subgraph](const Query4::PersonId a, const Query4::PersonId b) {
-         return subgraph.personComponents[a]<subgraph.personComponents[b] || (subgraph.personComponents[a]==subgraph.personComponents[b] && subgraph.retrieve(a)->size() > subgraph.retrieve(b)->size());
+         return subgraph.personComponents[a]<subgraph.personComponents[b] || (subgraph.personComponents[a]==subgraph.personComponents[b] && subgraph.degree(a) > subgraph.degree(b));
       });
    }
 };
 
 struct TwoHopDegreeOrdering {
-   static uint32_t countTwoHopNeighbors(Query4::PersonId p, const Query4::PersonSubgraph& subgraph) {
+   template<typename GraphT>
+   static uint32_t countTwoHopNeighbors(Query4::PersonId p, const GraphT& subgraph) {
       uint32_t n = 0;
-      auto bounds = subgraph.retrieve(p)->bounds();
+      auto bounds = subgraph.neighbors(p);
       while(bounds.first != bounds.second) {
-         n += subgraph.retrieve(*bounds.first)->size();
+         n += subgraph.degree(*bounds.first);
          bounds.first++;
       }
       return n;
    }
 
-   static void order(std::vector<Query4::PersonId>& ids, size_t maxBfs, size_t /*batchSize*/, const Query4::PersonSubgraph& subgraph) {
+   template<typename GraphT>
+   static void order(std::vector<Query4::PersonId>& ids, size_t maxBfs, size_t /*batchSize*/, const GraphT& subgraph) {
       if(maxBfs>ids.size()) {
          maxBfs=ids.size();
       }
@@ -69,10 +74,11 @@ struct TwoHopDegreeOrdering {
 
 struct NeighourDegreeOrdering {
 
-   static void order(std::vector<Query4::PersonId>& ids, size_t /*batchSize*/, const Query4::PersonSubgraph& subgraph) {
+   template<typename GraphT>
+   static void order(std::vector<Query4::PersonId>& ids, size_t /*batchSize*/, const GraphT& subgraph) {
       // Sort by degree
       std::sort(ids.begin(), ids.end(), [&subgraph](const Query4::PersonId a, const Query4::PersonId b) {
-         return subgraph.retrieve(a)->size() > subgraph.retrieve(b)->size();
+         return subgraph.degree(a) > subgraph.degree(b);
       });
 
       std::vector<Query4::PersonId> new_ids(ids.size());
@@ -92,7 +98,7 @@ struct NeighourDegreeOrdering {
          currentIx++;
 
          // Add friends
-         auto bounds = subgraph.retrieve(id)->bounds();
+         auto bounds = subgraph.neighbors(id);
          while(bounds.first != bounds.second) {
             if(!assigned[*bounds.first]) {
                new_ids[currentIx] = *bounds.first;
@@ -116,7 +122,8 @@ struct NeighourDegreeOrdering {
 };
 
 struct AdvancedNeighborOrdering {
-   static void order(std::vector<Query4::PersonId>& ids, size_t batchSize, const Query4::PersonSubgraph& subgraph) {
+   template<typename GraphT>
+   static void order(std::vector<Query4::PersonId>& ids, size_t batchSize, const GraphT& subgraph) {
       using namespace std;
       using NodeDegreePair = pair<Query4::PersonId, uint32_t>;
 
@@ -129,7 +136,7 @@ struct AdvancedNeighborOrdering {
 
       priority_queue<pair<Query4::PersonId, uint32_t>, vector<NodeDegreePair>, decltype(degreePairSorter)> degreeQueue(degreePairSorter);
       for(Query4::PersonId p=0; p<subgraph.size(); p++) {
-         degreeQueue.push(make_pair(p, subgraph.retrieve(p)->size()));
+         degreeQueue.push(make_pair(p, subgraph.degree(p)));
       }
 
       size_t currentIx=0;
@@ -140,7 +147,7 @@ struct AdvancedNeighborOrdering {
          if(assigned[topElement.first]) { continue; }
 
          uint32_t numUnprocessedFriends = 0;
-         auto bounds = subgraph.retrieve(topElement.first)->bounds();
+         auto bounds = subgraph.neighbors(topElement.first);
          while(bounds.first!=bounds.second) {
             if(!assigned[*bounds.first]) {
                numUnprocessedFriends++;
@@ -151,7 +158,7 @@ struct AdvancedNeighborOrdering {
          if(numUnprocessedFriends == topElement.second) {
             //We already have the correct number of unprocessed friends for this node
             queue<Query4::PersonId> assignedPersons;
-            auto bounds = subgraph.retrieve(topElement.first)->bounds();
+            auto bounds = subgraph.neighbors(topElement.first);
             while(bounds.first != bounds.second && numAssignedPersons < batchSize) {
                if(!assigned[*bounds.first]) {
                   assert(currentIx<subgraph.size());
@@ -178,7 +185,7 @@ struct AdvancedNeighborOrdering {
                   const auto p = assignedPersons.front();
                   assignedPersons.pop();
 
-                  auto bounds = subgraph.retrieve(p)->bounds();
+                  auto bounds = subgraph.neighbors(p);
                   while(bounds.first != bounds.second && numAssignedPersons < batchSize) {
                      if(!assigned[*bounds.first]) {
                         assert(currentIx<subgraph.size());
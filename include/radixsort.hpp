@@ -0,0 +1,15 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct Workers;
+
+namespace radix {
+   /// Sorts the keys with a parallel LSD radix sort on the worker pool and removes duplicates.
+   /// Digits that are equal for all keys are skipped, so dense ids only pay for their used bits.
+   void sortUnique(std::vector<uint64_t>& keys, Workers& workers);
+}
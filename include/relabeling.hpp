@@ -0,0 +1,115 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include "log.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <numeric>
+
+// Vertex relabelings that improve the locality of the per vertex bitsets in the batch BFS.
+// Each computes the new id of every vertex, i.e., newIds[oldId].
+
+/// Orders vertices by descending degree, hubs share the first cache lines
+struct DegreeRelabeling {
+   template<typename IdType, typename GraphT>
+   static std::vector<IdType> relabel(const GraphT& graph) {
+      std::vector<IdType> order(graph.size());
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [&graph](const IdType a, const IdType b) {
+         return graph.degree(a)>graph.degree(b);
+      });
+      return invert(order);
+   }
+
+   template<typename IdType>
+   static std::vector<IdType> invert(const std::vector<IdType>& order) {
+      std::vector<IdType> newIds(order.size());
+      for(size_t pos=0; pos<order.size(); pos++) {
+         newIds[order[pos]] = pos;
+      }
+      return newIds;
+   }
+};
+
+/// Numbers vertices in BFS visit order, neighbours of a vertex get close ids.
+/// Cuthill-McKee additionally starts each component at a low degree vertex and visits
+/// neighbours by ascending degree; the reversed order (RCM) minimizes the bandwidth.
+template<bool cuthillMcKee>
+struct BfsRelabeling {
+   template<typename IdType, typename GraphT>
+   static std::vector<IdType> relabel(const GraphT& graph) {
+      const size_t numVertices = graph.size();
+
+      // Component start candidates
+      std::vector<IdType> starts(numVertices);
+      std::iota(starts.begin(), starts.end(), 0);
+      std::stable_sort(starts.begin(), starts.end(), [&graph](const IdType a, const IdType b) {
+         return cuthillMcKee ? graph.degree(a)<graph.degree(b) : graph.degree(a)>graph.degree(b);
+      });
+
+      std::vector<IdType> order;
+      order.reserve(numVertices);
+      std::vector<uint8_t> visited(numVertices);
+      std::vector<IdType> neighbours;
+      for(const IdType start : starts) {
+         if(visited[start]) { continue; }
+         visited[start] = true;
+         size_t head = order.size();
+         order.push_back(start);
+         while(head<order.size()) {
+            const auto bounds = graph.neighbors(order[head++]);
+            neighbours.clear();
+            for(auto iter=bounds.first; iter!=bounds.second; ++iter) {
+               if(!visited[*iter]) {
+                  visited[*iter] = true;
+                  neighbours.push_back(*iter);
+               }
+            }
+            if(cuthillMcKee) {
+               std::stable_sort(neighbours.begin(), neighbours.end(), [&graph](const IdType a, const IdType b) {
+                  return graph.degree(a)<graph.degree(b);
+               });
+            }
+            order.insert(order.end(), neighbours.begin(), neighbours.end());
+         }
+      }
+
+      if(cuthillMcKee) {
+         std::reverse(order.begin(), order.end());
+      }
+      return DegreeRelabeling::invert(order);
+   }
+};
+
+/// Name of the relabeling selected by the GRAPH_RELABELING environment variable, "none" if unset
+inline std::string relabelingNameFromEnv() {
+   const char* relabelingStr = getenv("GRAPH_RELABELING");
+   return relabelingStr!=nullptr ? relabelingStr : "none";
+}
+
+/// Computes the relabeling selected by the GRAPH_RELABELING environment variable
+/// (degree, bfs or rcm). Returns an empty vector if the ids should be kept.
+template<typename IdType, typename GraphT>
+std::vector<IdType> relabelingFromEnv(const GraphT& graph) {
+   const std::string relabeling = relabelingNameFromEnv();
+   if(relabeling=="none") {
+      return std::vector<IdType>();
+   }
+
+   LOG_PRINT("[LOADING] Relabeling vertices by "<< relabeling);
+   if(relabeling=="degree") {
+      return DegreeRelabeling::relabel<IdType>(graph);
+   } else if(relabeling=="bfs") {
+      return BfsRelabeling<false>::relabel<IdType>(graph);
+   } else if(relabeling=="rcm") {
+      return BfsRelabeling<true>::relabel<IdType>(graph);
+   } else {
+      FATAL_ERROR("[LOADING] Unknown graph relabeling "<< relabeling);
+   }
+}
@@ -0,0 +1,59 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+/// Stream VByte coding of sorted id lists. Each value is stored as delta to its predecessor
+/// using 1-4 bytes. The byte lengths of four values are packed into one control byte, all
+/// control bytes of a list precede its data bytes.
+namespace streamvbyte {
+   /// Number of bytes the decoder may read past the end of an encoded list
+   static const size_t decodePadding = 16;
+
+   /// Data bytes used by the four values of a control byte
+   extern uint8_t lengthTable[256];
+   /// Shuffle mask that expands the data bytes of a control byte to four 32 bit values
+   extern uint8_t shuffleTable[256][16] __attribute__ ((aligned(16)));
+
+   /// Appends the encoding of count sorted unique values to out
+   void encodeSorted(const uint32_t* values, size_t count, std::vector<uint8_t>& out);
+
+   /// Decodes count values, out must have room for count rounded up to a multiple of four
+   inline void decodeSorted(const uint8_t* in, size_t count, uint32_t* __restrict__ out) {
+      const uint8_t* control = in;
+      const uint8_t* data = in+(count+3)/4;
+      #ifdef __SSSE3__
+      __m128i prev = _mm_setzero_si128();
+      for(size_t i=0; i<count; i+=4) {
+         const uint8_t key = *control++;
+         const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffleTable[key]));
+         __m128i values = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), shuffle);
+         data += lengthTable[key];
+
+         // Prefix sum of the deltas, offset by the last value of the previous group
+         values = _mm_add_epi32(values, _mm_slli_si128(values, 4));
+         values = _mm_add_epi32(values, _mm_slli_si128(values, 8));
+         prev = _mm_add_epi32(values, _mm_shuffle_epi32(prev, 0xff));
+         _mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), prev);
+      }
+      #else
+      uint32_t prev = 0;
+      for(size_t i=0; i<count; i++) {
+         const uint32_t length = ((control[i/4]>>(2*(i%4)))&3)+1;
+         uint32_t delta = 0;
+         memcpy(&delta, data, length);
+         data += length;
+         prev += delta;
+         out[i] = prev;
+      }
+      #endif
+   }
+}
@@ -3,6 +3,7 @@
 //Code must not be used, distributed, without written consent by the authors
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 #include <utility>
@@ -93,4 +94,60 @@ namespace awfy {
          return topMatches;
       }
    };
+
+   /// Top k values in a binary heap with the smallest value in front, the entries are not sorted.
+   /// Cheaper to update than TopKList, used to collect results before they are merged.
+   template<class Key, class Value>
+   class TopKHeap {
+   public:
+      typedef std::pair<Key, Value> EntryPair;
+
+   private:
+      std::vector<EntryPair> heap;
+      const size_t k;
+
+      // Orders larger values first, so the heap keeps the smallest value in front
+      static bool isLarger(const EntryPair& a, const EntryPair& b) {
+         return compare(a, b);
+      }
+
+   public:
+      explicit TopKHeap(const size_t k) : k(k) {
+         heap.reserve(k);
+      }
+
+      TopKHeap(const TopKHeap&) = delete;
+      TopKHeap& operator=(const TopKHeap&) = delete;
+
+      bool isFull() const {
+         return heap.size()>=k;
+      }
+
+      /// Smallest of the top k values, only defined once the heap is full
+      const EntryPair& getBound() const {
+         assert(!heap.empty());
+         return heap.front();
+      }
+
+      /// Inserts the value if it is among the top k, returns whether it was inserted
+      bool insert(const Key& key, const Value& value) {
+         EntryPair pair = std::make_pair(key, value);
+         if(heap.size()<k) {
+            heap.push_back(pair);
+            std::push_heap(heap.begin(), heap.end(), isLarger);
+            return true;
+         }
+         if(k==0 || !compare(pair, heap.front())) {
+            return false;
+         }
+         std::pop_heap(heap.begin(), heap.end(), isLarger);
+         heap.back() = pair;
+         std::push_heap(heap.begin(), heap.end(), isLarger);
+         return true;
+      }
+
+      const std::vector<EntryPair>& getEntries() const {
+         return heap;
+      }
+   };
 }
\ No newline at end of file
@@ -13,5 +13,9 @@ struct Workers {
    Workers(uint32_t numWorkers);
 
    void assist(Scheduler& scheduler);
+   /// Runs the tasks on the pool and the calling thread, returns once all are finished
+   void runAll(std::vector<Task> tasks);
+   /// Splits [0,count) into ranges and runs fn(begin,end) for each of them on the pool
+   void runRanges(size_t count, const std::function<void(size_t,size_t)>& fn);
    void close();
 };
@@ -2,6 +2,7 @@
 //
 //Code must not be used, distributed, without written consent by the authors
 #include "include/bench.hpp"
+#include "include/dispatch.hpp"
 #include "include/TraceStats.hpp"
 
 int main(int argc, char** argv) {
@@ -25,18 +26,19 @@ int main(int argc, char** argv) {
    }
 
    vector<std::unique_ptr<BFSBenchmark>> benchmarks;
-   #ifdef AVX2
-   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,1,true>>("Huge Batch BFS Runner 256 SP    (width 1)")));
-   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,1,false>>("Huge Batch BFS Runner 256 NoSP  (width 1)")));
-   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,2,true>>("Huge Batch BFS Runner 256 SP    (width 2)")));
-   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,2,false>>("Huge Batch BFS Runner 256 NoSp  (width 2)")));
-   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,4,true>>("Huge Batch BFS Runner 256 SP    (width 4)")));
-   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m256i,4,false>>("Huge Batch BFS Runner 256 NoSp  (width 4)")));
-   // benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::BatchBFSRunner256>("Batch BFS Runner 256")));
-   #endif
+   const dispatch::VectorIsa vectorIsa = dispatch::detectVectorIsa();
+   LOG_PRINT("[Main] Using "<< static_cast<int>(vectorIsa) <<" bit batch BFS kernels");
+   if(vectorIsa>=dispatch::VectorIsa::Avx2) {
+      dispatch::addAvx2Benchmarks(benchmarks);
+   }
+   if(vectorIsa>=dispatch::VectorIsa::Avx512) {
+      dispatch::addAvx512Benchmarks(benchmarks);
+   }
    //benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m128i,1>>("Huge Batch BFS Runner 128 (width 1)")));
    //benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<uint64_t,1>>("Huge Batch BFS Runner 64 (width 1)")));
    benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m128i,4,false>>("Huge Batch BFS Runner 128 (width 4)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m128i,4,false>,Query4::PersonCsrSubgraph>("Huge Batch BFS Runner 128 CSR (width 4)")));
+   benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<__m128i,4,false>,Query4::PersonCompressedSubgraph>("Huge Batch BFS Runner 128 VByte (width 4)")));
    // benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<uint64_t,8>>("Huge Batch BFS Runner 64 (width 8)")));
    //benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<uint32_t,16>>("Huge Batch BFS Runner 32 (width 16)")));
    //benchmarks.push_back(std::unique_ptr<BFSBenchmark>(new SpecializedBFSBenchmark<Query4::HugeBatchBfs<uint16_t,32>>("Huge Batch BFS Runner 16 (width 32)")));
@@ -58,24 +60,31 @@ int main(int argc, char** argv) {
    }
    LOG_PRINT("[Main] Max batch size: "<<maxBatchSize);
 
+   // With BATCH_THREADS>1 every batch is processed by a team, so fewer batches run concurrently
+   const size_t numExecutors = std::max<size_t>(1, numThreads/Query4::BatchTeam::teamSize());
+   if(Query4::BatchTeam::teamSize()>1) {
+      LOG_PRINT("[Main] Running "<< numExecutors <<" batches concurrently with "<< Query4::BatchTeam::teamSize() <<" threads each");
+   }
+
    // Allocate additional worker threads
-   Workers workers(numThreads-1);
+   Workers workers(numExecutors-1);
 
    // Run benchmarks
    uint32_t minAvgRuntime=std::numeric_limits<uint32_t>::max();
    for(unsigned i=0; i<queries.queries.size(); i++) {
       Query query = queries.queries[i];
       LOG_PRINT("[Main] Executing query "<<query.dataset);
-      auto personGraph = Graph<Query4::PersonId>::loadFromPath(query.dataset);
+      auto personGraph = Graph<Query4::PersonId>::loadFromPath(query.dataset, workers);
       {
-         auto ranges = generateTasks(bfsLimit, personGraph.size(), maxBatchSize);
-         auto desiredTasks=numThreads*4;
+         auto desiredTasks=numExecutors*4;
+         auto ranges = generateTasks(bfsLimit, personGraph.size(), maxBatchSize, desiredTasks);
          if(ranges.size()<desiredTasks) {
             FATAL_ERROR("[Main] Not enough tasks! #Threads="<<numThreads<<", #Tasks="<<ranges.size()<<", #DesiredTasks="<<desiredTasks);
          }
       }
       // XXX: Do one warmup run?
       for(const auto& b : benchmarks) {
+         b->prepare(personGraph);
          cout<<"# Benchmarking "<<b->name<<" ... ";
          cout.flush();
          for(int a=0; a<numRuns; a++) {
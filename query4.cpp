@@ -6,17 +6,33 @@
 #include <random>
 #include <bitset>
 #include <cstring>
+#include <algorithm>
 #include "query4.hpp"
 #include <cstdlib>
+#include <cmath>
+#include <atomic>
 
 using namespace std;
 
-std::vector<pair<Query4::PersonId,Query4::PersonId>> generateTasks(const uint64_t maxBfs, const Query4::PersonId graphSize, const size_t batchSize) {
+std::vector<pair<Query4::PersonId,Query4::PersonId>> generateTasks(const uint64_t maxBfs, const Query4::PersonId graphSize, const size_t batchSize, const size_t minTasks) {
    // Determine number of persons
    Query4::PersonId numBfs = graphSize<maxBfs?graphSize:maxBfs;
 
    // Initialize task size as max of minMorselSize and batchSize;
    uint32_t taskSize=batchSize<Query4::minMorselSize?Query4::minMorselSize:batchSize;
+   uint32_t morselSize=taskSize;
+   if(Query4::isBatchRefillEnabled()) {
+      morselSize=batchSize*Query4::refillMorselBatches;
+   }
+   // Interleaved batches are taken from the same morsel
+   if(Query4::getBatchPipelineDepth()>1 && morselSize<batchSize*Query4::getBatchPipelineDepth()) {
+      morselSize=batchSize*Query4::getBatchPipelineDepth();
+   }
+   // Larger morsels must still leave enough tasks for all executors
+   while(morselSize>taskSize && (numBfs+morselSize-1)/morselSize<minTasks) {
+      morselSize-=batchSize;
+   }
+   taskSize=morselSize;
 
    // Increase task size until max morsel tasks limit is met
    while(numBfs/taskSize>Query4::maxMorselTasks) {
@@ -48,46 +64,175 @@ size_t getMaxMorselBatchSize() {
    }
 }
 
+bool isBatchRefillEnabled() {
+   static const bool enabled = getenv("BATCH_REFILL")!=nullptr;
+   return enabled;
+}
+
+size_t getBatchPipelineDepth() {
+   static const size_t depth = [] {
+      const char* depthStr = getenv("BATCH_PIPELINE");
+      if(depthStr==nullptr) {
+         return size_t(1);
+      }
+      const int value = atoi(depthStr);
+      if(value<1 || value>static_cast<int>(MAX_THREAD_WORKSPACES)) {
+         FATAL_ERROR("[Query4] BATCH_PIPELINE must be between 1 and "<<MAX_THREAD_WORKSPACES);
+      }
+      return static_cast<size_t>(value);
+   }();
+   return depth;
+}
+
+bool isTopKPruningEnabled() {
+   static const bool enabled = [] {
+      const char* pruningStr = getenv("TOPK_PRUNING");
+      return pruningStr==nullptr || strcmp(pruningStr, "off")!=0;
+   }();
+   return enabled;
+}
+
+QueryType getQueryType() {
+   static const QueryType type = [] {
+      const char* queryStr = getenv("QUERY");
+      if(queryStr==nullptr || strcmp(queryStr, "centrality")==0) {
+         return QueryType::Centrality;
+      } else if(strcmp(queryStr, "eccentricity")==0) {
+         return QueryType::Eccentricity;
+      } else if(strcmp(queryStr, "sampled")==0) {
+         return QueryType::SampledCloseness;
+      }
+      FATAL_ERROR("[Query4] Invalid QUERY value "<<queryStr);
+   }();
+   return type;
+}
+
+size_t getNumSampledSources(size_t defaultSources) {
+   const char* sourcesStr = getenv("SAMPLE_SOURCES");
+   if(sourcesStr==nullptr) {
+      return defaultSources;
+   }
+   const long sources = atol(sourcesStr);
+   if(sources<=0) {
+      FATAL_ERROR("[Query4] SAMPLE_SOURCES must be positive");
+   }
+   return sources;
+}
+
+std::string getSampleOutputFile() {
+   const char* fileStr = getenv("SAMPLE_OUTPUT");
+   return fileStr!=nullptr ? fileStr : "";
+}
+
+uint64_t getNextQueryId() {
+   static std::atomic<uint64_t> nextQueryId(1);
+   return nextQueryId++;
+}
+
 double getCloseness(uint32_t totalPersons,uint64_t totalDistances,uint32_t totalReachable) {
    return (totalDistances>0 && totalReachable>0 && totalPersons>0)
             ? static_cast<double>((totalReachable-1)*(totalReachable-1)) / (static_cast<double>((totalPersons-1))*totalDistances)
             : 0.0;
 }
 
+static const CentralityMetric allMetrics[] = { CentralityMetric::Closeness, CentralityMetric::Harmonic, CentralityMetric::Lin, CentralityMetric::Decay };
 
-ResultConcatenator::ResultConcatenator(QueryState* state, const char*& resultOut
-   #ifdef STATISTICS
-   , BatchStatistics& statistics
-   #endif
-   )
-   : state(state), resultOut(resultOut)
-   #ifdef STATISTICS
-   , statistics(statistics)
-   #endif
-{ 
+const char* getCentralityName(CentralityMetric metric) {
+   switch(metric) {
+   case CentralityMetric::Closeness:
+      return "closeness";
+   case CentralityMetric::Harmonic:
+      return "harmonic";
+   case CentralityMetric::Lin:
+      return "lin";
+   case CentralityMetric::Decay:
+      return "decay";
+   }
+   return "";
 }
 
-void ResultConcatenator::operator()() {
-   #ifdef STATISTICS
-   statistics.print();
-   #endif
+const std::vector<CentralityMetric>& getCentralityMetrics() {
+   static const std::vector<CentralityMetric> metrics = [] {
+      std::vector<CentralityMetric> selected;
+      const char* metricStr = getenv("CENTRALITY");
+      if(metricStr==nullptr) {
+         selected.push_back(CentralityMetric::Closeness);
+         return selected;
+      }
+      std::istringstream metricList(metricStr);
+      std::string name;
+      while(std::getline(metricList, name, ',')) {
+         bool found=false;
+         for(const CentralityMetric metric : allMetrics) {
+            if(name==getCentralityName(metric)) {
+               if(std::find(selected.begin(), selected.end(), metric)==selected.end()) {
+                  selected.push_back(metric);
+               }
+               found=true;
+            }
+         }
+         if(!found) {
+            FATAL_ERROR("[Query4] Invalid CENTRALITY value "<<name);
+         }
+      }
+      if(selected.empty()) {
+         FATAL_ERROR("[Query4] CENTRALITY lists no metric");
+      }
+      return selected;
+   }();
+   return metrics;
+}
 
-   ostringstream output;
-   auto& topEntries=state->topResults.getEntries();
-   assert(topEntries.size()<=state->k);
-   const uint32_t resNum = min(state->k, (uint32_t)topEntries.size());
-   for (uint32_t i=0; i<resNum; i++){
-      if(i>0) {
-         output<<"|";
+double getDecayFactor() {
+   static const double factor = [] {
+      const char* factorStr = getenv("CENTRALITY_DECAY");
+      if(factorStr==nullptr) {
+         return 0.5;
+      }
+      const double value = atof(factorStr);
+      if(value<=0 || value>=1) {
+         FATAL_ERROR("[Query4] CENTRALITY_DECAY must be between 0 and 1");
       }
+      return value;
+   }();
+   return factor;
+}
+
+// Lin's index counts the person itself as reachable, an isolated person has index 1
+static double getLinIndex(uint32_t numReachable, uint64_t totalDistances) {
+   return totalDistances>0 ? static_cast<double>(uint64_t(numReachable+1)*(numReachable+1))/totalDistances : 1.0;
+}
 
-      output<<state->subgraph.mapInternalNodeId(topEntries[i].first);
+double getCentrality(CentralityMetric metric, const BatchBFSdata& bfsData) {
+   switch(metric) {
+   case CentralityMetric::Closeness:
+      return getCloseness(bfsData.componentSize, bfsData.totalDistances, bfsData.totalReachable);
+   case CentralityMetric::Harmonic:
+      return bfsData.levelSums[HARMONIC_SUM];
+   case CentralityMetric::Lin:
+      return getLinIndex(bfsData.totalReachable, bfsData.totalDistances);
+   case CentralityMetric::Decay:
+      return bfsData.levelSums[DECAY_SUM];
    }
-   const auto& outStr = output.str();
-   auto resultBuffer = new char[outStr.size()+1];
-   outStr.copy(resultBuffer, outStr.size());
-   resultBuffer[outStr.size()]=0;
-   resultOut = resultBuffer;
-   delete state;
-}
-}
\ No newline at end of file
+   return 0.0;
+}
+
+double getCentralityBound(CentralityMetric metric, const BatchBFSdata& bfsData, uint32_t distance) {
+   // All persons of the component are reached in the end, the missing ones at distance+1 or more
+   const uint32_t finalReachable = bfsData.componentSize-1;
+   const uint32_t numMissing = finalReachable-bfsData.totalReachable;
+   const uint64_t minDistances = bfsData.totalDistances + uint64_t(numMissing)*(distance+1);
+   switch(metric) {
+   case CentralityMetric::Closeness:
+      return getCloseness(bfsData.componentSize, minDistances, finalReachable);
+   case CentralityMetric::Harmonic:
+      return bfsData.levelSums[HARMONIC_SUM] + static_cast<double>(numMissing)/(distance+1);
+   case CentralityMetric::Lin:
+      return getLinIndex(finalReachable, minDistances);
+   case CentralityMetric::Decay:
+      return bfsData.levelSums[DECAY_SUM] + numMissing*pow(getDecayFactor(), distance+1);
+   }
+   return std::numeric_limits<double>::max();
+}
+
+}
@@ -21,7 +21,10 @@
 #include "include/bfs/batch256.hpp"
 #include "include/bfs/statistics.hpp"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <sstream>
 #include <cmath>
 #include <algorithm>
 #include <random>
@@ -35,14 +38,19 @@ namespace Query4 {
 
 static const uint32_t maxMorselTasks = 256000;
 static const uint32_t minMorselSize = 1;
+// With BATCH_REFILL, morsels span several batches so that finished lanes can be refilled from them
+static const uint32_t refillMorselBatches = 4;
+
+// External ids are used for results, so ties are broken independent of the internal vertex order
+typedef uint64_t ExternalPersonId;
 
 struct CentralityResult {
-   PersonId person;
+   ExternalPersonId person;
    uint64_t distances;
    uint32_t numReachable;
    double centrality;
 
-   CentralityResult(PersonId person, uint64_t distances, uint32_t numReachable, double centrality)
+   CentralityResult(ExternalPersonId person, uint64_t distances, uint32_t numReachable, double centrality)
       : person(person), distances(distances), numReachable(numReachable), centrality(centrality) {
    }
 
@@ -56,7 +64,7 @@ struct CentralityResult {
    }
 };
 
-typedef std::pair<PersonId, CentralityResult> CentralityEntry;
+typedef std::pair<ExternalPersonId, CentralityResult> CentralityEntry;
 }
 
 namespace awfy {
@@ -77,47 +85,260 @@ public:
 namespace Query4 {
 typedef awfy::TopKComparer<CentralityEntry> CentralityCmp;
 
+uint64_t getNextQueryId();
+
+template<typename GraphT>
 class QueryState {
 public:
+   typedef awfy::TopKHeap<ExternalPersonId, CentralityResult> LocalTopK;
+   typedef awfy::TopKList<ExternalPersonId, CentralityResult> TopK;
+
+   // Top k of every metric collected by one thread
+   struct LocalResults {
+      vector<unique_ptr<LocalTopK>> metrics;
+
+      LocalResults(const size_t numMetrics, const uint32_t k) {
+         for(size_t m=0; m<numMetrics; m++) {
+            metrics.emplace_back(new LocalTopK(k));
+         }
+      }
+   };
+
    const uint32_t k;
-   const PersonSubgraph& subgraph;
+   const GraphT& subgraph;
    const uint64_t startTime;
+   const uint64_t queryId;
+   const size_t numMetrics;
 
    vector<uint8_t> personChecked;
 
-   mutex topResultsMutex;
-   awfy::TopKList<PersonId, CentralityResult> topResults;
+   // Every thread collects its results separately, they are merged into topResults once all tasks finished
+   mutex localResultsMutex;
+   vector<unique_ptr<LocalResults>> localResults;
+   // Largest k-th value of the local results per metric, a lower bound of the final k-th value
+   unique_ptr<atomic<double>[]> centralityBounds;
+   vector<unique_ptr<TopK>> topResults;
+
+   QueryState(const uint32_t k, const GraphT& subgraph, const size_t numMetrics)
+      : k(k), subgraph(move(subgraph)), startTime(tschrono::now()), queryId(getNextQueryId()), numMetrics(numMetrics), personChecked(subgraph.size()), localResultsMutex(),
+         centralityBounds(new atomic<double>[numMetrics]) {
+      for(size_t m=0; m<numMetrics; m++) {
+         centralityBounds[m].store(0.0, memory_order_relaxed);
+         topResults.emplace_back(new TopK(make_pair(std::numeric_limits<ExternalPersonId>::max(),CentralityResult(std::numeric_limits<ExternalPersonId>::max(), 0, 0, 0.0))));
+         topResults.back()->init(k);
+      }
+   }
 
-   QueryState(const uint32_t k, const PersonSubgraph& subgraph)
-      : k(k), subgraph(move(subgraph)), startTime(tschrono::now()), personChecked(subgraph.size()), topResultsMutex(),
-         topResults(make_pair(std::numeric_limits<PersonId>::max(),CentralityResult(std::numeric_limits<PersonId>::max(), 0, 0, 0.0))) {
-      topResults.init(k);
+   /// Results of the calling thread, created on its first call for this query
+   LocalResults& getLocalResults() {
+      static __thread uint64_t localQueryId=0;
+      static __thread LocalResults* local=nullptr;
+      if(localQueryId!=queryId) {
+         lock_guard<mutex> lock(localResultsMutex);
+         localResults.emplace_back(new LocalResults(numMetrics, k));
+         local = localResults.back().get();
+         localQueryId = queryId;
+      }
+      return *local;
+   }
+
+   /// Centrality a person must reach to be added to the top k results of the metric, 0 while no thread has k results
+   double minCentrality(const size_t metric) const {
+      return centralityBounds[metric].load(memory_order_relaxed);
+   }
+
+   void raiseBound(const size_t metric, const double centrality) {
+      double current = centralityBounds[metric].load(memory_order_relaxed);
+      while(centrality>current && !centralityBounds[metric].compare_exchange_weak(current, centrality, memory_order_relaxed)) {
+      }
+   }
+
+   void mergeLocalResults() {
+      for(const auto& local : localResults) {
+         for(size_t m=0; m<numMetrics; m++) {
+            for(const auto& entry : local->metrics[m]->getEntries()) {
+               topResults[m]->insert(entry.first, entry.second);
+            }
+         }
+      }
+      localResults.clear();
    }
 };
 
 double getCloseness(uint32_t totalPersons,uint64_t totalDistances,uint32_t totalReachable);
 
+// Centralities that rank the persons, selected with CENTRALITY as a comma separated list
+enum class CentralityMetric { Closeness, Harmonic, Lin, Decay };
+// Slots of the level sums in BatchBFSdata
+static const unsigned HARMONIC_SUM = 0;
+static const unsigned DECAY_SUM = 1;
+
+const std::vector<CentralityMetric>& getCentralityMetrics();
+const char* getCentralityName(CentralityMetric metric);
+double getDecayFactor();
+/// Centrality of a person whose BFS finished
+double getCentrality(CentralityMetric metric, const BatchBFSdata& bfsData);
+/// Upper bound of the centrality of a person whose BFS found all vertices up to distance
+double getCentralityBound(CentralityMetric metric, const BatchBFSdata& bfsData, uint32_t distance);
+
+// Sums the harmonic (1/d) and the decay (factor^d) centrality in the same pass
+struct CentralityLevelSums : public LevelAccumulator {
+   const double decayFactor;
+
+   CentralityLevelSums(double decayFactor) : decayFactor(decayFactor) {
+   }
+
+   void addLevel(BatchBFSdata& bfsData, uint32_t distance, uint32_t numDiscovered) override {
+      bfsData.levelSums[HARMONIC_SUM] += static_cast<double>(numDiscovered)/distance;
+      bfsData.levelSums[DECAY_SUM] += numDiscovered*pow(decayFactor, distance);
+   }
+};
+
+template<typename GraphT>
 struct ResultConcatenator {
-   QueryState* state;
+   QueryState<GraphT>* state;
    const char*& resultOut;
    #ifdef STATISTICS
    BatchStatistics& statistics;
    #endif
 
-   ResultConcatenator(QueryState* state, const char*& resultOut
+   ResultConcatenator(QueryState<GraphT>* state, const char*& resultOut
       #ifdef STATISTICS
       , BatchStatistics& statistics
       #endif
-      );
-   void operator()();
+      )
+      : state(state), resultOut(resultOut)
+      #ifdef STATISTICS
+      , statistics(statistics)
+      #endif
+   {
+   }
+
+   void operator()() {
+      #ifdef STATISTICS
+      statistics.print();
+      #endif
+
+      state->mergeLocalResults();
+      ostringstream output;
+      // With several metrics every top k is prefixed by the name of its metric
+      const auto& metrics = getCentralityMetrics();
+      for(size_t m=0; m<metrics.size(); m++) {
+         if(metrics.size()>1) {
+            output<<(m>0?" ":"")<<getCentralityName(metrics[m])<<"=";
+         }
+         auto& topEntries=state->topResults[m]->getEntries();
+         assert(topEntries.size()<=state->k);
+         const uint32_t resNum = min(state->k, (uint32_t)topEntries.size());
+         for (uint32_t i=0; i<resNum; i++){
+            if(i>0) {
+               output<<"|";
+            }
+
+            output<<topEntries[i].first;
+         }
+      }
+      const auto& outStr = output.str();
+      auto resultBuffer = new char[outStr.size()+1];
+      outStr.copy(resultBuffer, outStr.size());
+      resultBuffer[outStr.size()]=0;
+      resultOut = resultBuffer;
+      delete state;
+   }
 
    // ResultConcatenator(ResultConcatenator&&) = default;
    // ResultConcatenator& operator=(ResultConcatenator&&) = default;
 };
 
 size_t getMaxMorselBatchSize();
+bool isBatchRefillEnabled();
+size_t getBatchPipelineDepth();
+bool isTopKPruningEnabled();
+
+// Query run by the benchmarks, selected with QUERY
+enum class QueryType { Centrality, Eccentricity, SampledCloseness };
+QueryType getQueryType();
+/// Number of sources of QUERY=sampled, SAMPLE_SOURCES overrides the default
+size_t getNumSampledSources(size_t defaultSources);
+/// File that QUERY=sampled writes the estimates of all persons to, empty if SAMPLE_OUTPUT is not set
+std::string getSampleOutputFile();
+
+// Only runners taking a BatchSourceFeed refill lanes, prune sources and report levels, the others get
+// the feed's sources in the next batch and run every source to completion
+template<typename BFSRunnerT, typename GraphT>
+auto runBatchWithFeed(vector<BatchBFSdata>& batchData, const GraphT& subgraph
+   #ifdef STATISTICS
+   , BatchStatistics& statistics
+   #endif
+   , BatchSourceFeed* feed, BatchSourcePruner* pruner, LevelAccumulator* accumulator, int)
+   -> decltype(BFSRunnerT::runBatch(batchData, subgraph
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      , feed, pruner, accumulator)) {
+   return BFSRunnerT::runBatch(batchData, subgraph
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      , feed, pruner, accumulator);
+}
+
+template<typename BFSRunnerT, typename GraphT>
+void runBatchWithFeed(vector<BatchBFSdata>& batchData, const GraphT& subgraph
+   #ifdef STATISTICS
+   , BatchStatistics& statistics
+   #endif
+   , BatchSourceFeed* /*feed*/, BatchSourcePruner* /*pruner*/, LevelAccumulator* accumulator, long) {
+   if(accumulator!=nullptr) {
+      FATAL_ERROR("[Query4] The BFS runner does not report levels, only closeness is supported");
+   }
+   BFSRunnerT::runBatch(batchData, subgraph
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      );
+}
+
+// Runners that cannot interleave batches run them one after the other
+template<typename BFSRunnerT, typename GraphT>
+auto runBatchesInterleaved(vector<vector<BatchBFSdata>>& batches, const GraphT& subgraph
+   #ifdef STATISTICS
+   , BatchStatistics& statistics
+   #endif
+   , BatchSourceFeed* feed, BatchSourcePruner* pruner, LevelAccumulator* accumulator, int)
+   -> decltype(BFSRunnerT::runBatches(batches, subgraph
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      , feed, pruner, accumulator)) {
+   return BFSRunnerT::runBatches(batches, subgraph
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      , feed, pruner, accumulator);
+}
 
-template<typename BFSRunnerT>
+template<typename BFSRunnerT, typename GraphT>
+void runBatchesInterleaved(vector<vector<BatchBFSdata>>& batches, const GraphT& subgraph
+   #ifdef STATISTICS
+   , BatchStatistics& statistics
+   #endif
+   , BatchSourceFeed* /*feed*/, BatchSourcePruner* /*pruner*/, LevelAccumulator* accumulator, long) {
+   if(accumulator!=nullptr) {
+      FATAL_ERROR("[Query4] The BFS runner does not report levels, only closeness is supported");
+   }
+   for(auto& batchData : batches) {
+      if(batchData.size()>0) {
+         BFSRunnerT::runBatch(batchData, subgraph
+            #ifdef STATISTICS
+            , statistics
+            #endif
+            );
+      }
+   }
+}
+
+template<typename BFSRunnerT, typename GraphT=PersonSubgraph>
 struct MorselTask {
 private:
    const uint32_t rangeStart;
@@ -125,8 +346,8 @@ private:
 
    size_t batchSize;
 
-   QueryState& state;
-   const PersonSubgraph& subgraph;
+   QueryState<GraphT>& state;
+   const GraphT& subgraph;
    vector<PersonId>& ids;
 
    const uint64_t startTime;
@@ -137,7 +358,7 @@ private:
    #endif
 
 public:
-   MorselTask(QueryState& state, PersonId rangeStart, PersonId rangeEnd, const PersonSubgraph& subgraph, vector<PersonId>& ids, uint64_t startTime
+   MorselTask(QueryState<GraphT>& state, PersonId rangeStart, PersonId rangeEnd, const GraphT& subgraph, vector<PersonId>& ids, uint64_t startTime
       #ifdef STATISTICS
       , BatchStatistics& statistics
       #endif
@@ -153,52 +374,157 @@ public:
       }
    }
 
-   //Returns pair of processed persons and whether the bound was updated
-   pair<uint32_t,bool> processPersonBatch(PersonId begin, PersonId end) {
+   void addPerson(vector<BatchBFSdata>& batchData, PersonId index) {
+      PersonId subgraphPersonId = ids[index];
+      assert(!state.personChecked[subgraphPersonId]);
+
+      const uint32_t componentSize = subgraph.componentSizes[subgraph.personComponents[subgraphPersonId]];
+
+      BatchBFSdata personData(subgraphPersonId, componentSize);
+
+      state.personChecked[subgraphPersonId] = true;
+      batchData.push_back(move(personData));
+   }
+
+   // Hands out the remaining persons of the morsel to a running batch
+   struct RemainingPersons : public BatchSourceFeed {
+      MorselTask& task;
+      PersonId& index;
+      const PersonId end;
+
+      RemainingPersons(MorselTask& task, PersonId& index, PersonId end) : task(task), index(index), end(end) {
+      }
+
+      size_t admit(vector<BatchBFSdata>& batchData, size_t max) override {
+         size_t numAdded=0;
+         for(; numAdded<max && index<end; index++, numAdded++) {
+            task.addPerson(batchData, index);
+         }
+         return numAdded;
+      }
+   };
+
+   // Stops sources whose centrality cannot reach the current top k bound. Vertices that were not
+   // found yet are at least one level further away, so the centrality is at most that of a BFS
+   // that finds all of them in the next level. Only used if a single metric is requested.
+   struct CentralityBound : public BatchSourcePruner {
+      QueryState<GraphT>& state;
+      const CentralityMetric metric;
+      double minCentrality;
+
+      CentralityBound(QueryState<GraphT>& state, CentralityMetric metric) : state(state), metric(metric), minCentrality(0) {
+      }
+
+      void startRound() override {
+         minCentrality = state.minCentrality(0);
+      }
+
+      bool canQualify(const BatchBFSdata& bfsData, uint32_t distance) override {
+         return getCentralityBound(metric, bfsData, distance) >= minCentrality-awfy::EPSILON;
+      }
+   };
+
+   // Closeness and Lin's index only need the totals
+   static bool needsLevelSums() {
+      for(const CentralityMetric metric : getCentralityMetrics()) {
+         if(metric==CentralityMetric::Harmonic || metric==CentralityMetric::Decay) {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   // Pruned sources would be missing from the rankings of the other metrics
+   static bool isPruningEnabled() {
+      return isTopKPruningEnabled() && getCentralityMetrics().size()==1;
+   }
+
+   void addResults(const vector<BatchBFSdata>& batchData) {
+      typename QueryState<GraphT>::LocalResults& localResults = state.getLocalResults();
+      const auto& metrics = getCentralityMetrics();
+      for(size_t m=0; m<metrics.size(); m++) {
+         typename QueryState<GraphT>::LocalTopK& localTopK = *localResults.metrics[m];
+         const double minCentrality = state.minCentrality(m);
+         for(auto bIter=batchData.begin(); bIter!=batchData.end(); bIter++) {
+            if(bIter->pruned) {
+               continue;
+            }
+            const auto centrality = getCentrality(metrics[m], *bIter);
+            // Persons below the k-th value of another thread cannot qualify
+            if(centrality<minCentrality-awfy::EPSILON) {
+               continue;
+            }
+            const ExternalPersonId externalPersonId = subgraph.mapInternalNodeId(bIter->person);
+            CentralityResult resultCentrality(externalPersonId, bIter->totalDistances, bIter->totalReachable, centrality);
+
+            if(localTopK.insert(resultCentrality.person, resultCentrality) && localTopK.isFull()) {
+               state.raiseBound(m, localTopK.getBound().second.centrality);
+            }
+         }
+      }
+   }
+
+   // Builds up to numBatches batches that the runner may interleave on this thread
+   uint32_t processPersonBatches(PersonId begin, PersonId end, size_t numBatches) {
+      vector<vector<BatchBFSdata>> batches(numBatches);
+      PersonId index=begin;
+      for(auto& batchData : batches) {
+         batchData.reserve(batchSize);
+         for(; batchData.size()<batchSize && index<end; index++) {
+            addPerson(batchData, index);
+         }
+      }
+
+      // Lanes of all batches may be refilled with the persons of this morsel that are left
+      RemainingPersons remaining(*this, index, end);
+      CentralityBound bound(state, getCentralityMetrics().front());
+      CentralityLevelSums levelSums(getDecayFactor());
+      runBatchesInterleaved<BFSRunnerT>(batches, state.subgraph
+         #ifdef STATISTICS
+         , statistics
+         #endif
+         , isBatchRefillEnabled() && batchSize==BFSRunnerT::batchSize() ? &remaining : nullptr
+         , isPruningEnabled() ? &bound : nullptr, needsLevelSums() ? &levelSums : nullptr, 0);
+
+      for(const auto& batchData : batches) {
+         addResults(batchData);
+      }
+      return index-begin;
+   }
+
+   //Returns the number of processed persons
+   uint32_t processPersonBatch(PersonId begin, PersonId end) {
+      const size_t pipelineDepth = getBatchPipelineDepth();
+      if(pipelineDepth>1) {
+         return processPersonBatches(begin, end, pipelineDepth);
+      }
+
       // Build batch with the desired size
       vector<BatchBFSdata> batchData;
       batchData.reserve(batchSize);
 
       PersonId index=begin;
       for(; batchData.size()<batchSize && index<end; index++) {
-         PersonId subgraphPersonId = ids[index];
-         assert(!state.personChecked[subgraphPersonId]);
-
-         const uint32_t componentSize = subgraph.componentSizes[subgraph.personComponents[subgraphPersonId]];
-
-         BatchBFSdata personData(subgraphPersonId, componentSize);
-
-         state.personChecked[subgraphPersonId] = true;
-         batchData.push_back(move(personData));
+         addPerson(batchData, index);
       }
-      const uint32_t last = index-1;
       // #endif
 
-
-      bool boundUpdated=false;
       if(batchData.size()>0) {
-         //Run BFS
-         BFSRunnerT::runBatch(batchData, state.subgraph
+         //Run BFS, lanes may be refilled with further persons of this morsel
+         RemainingPersons remaining(*this, index, end);
+         CentralityBound bound(state, getCentralityMetrics().front());
+         CentralityLevelSums levelSums(getDecayFactor());
+         runBatchWithFeed<BFSRunnerT>(batchData, state.subgraph
             #ifdef STATISTICS
             , statistics
             #endif
-            );
+            , isBatchRefillEnabled() && batchSize==BFSRunnerT::batchSize() ? &remaining : nullptr
+            , isPruningEnabled() ? &bound : nullptr, needsLevelSums() ? &levelSums : nullptr, 0);
 
-         for(auto bIter=batchData.begin(); bIter!=batchData.end(); bIter++) {
-            const auto closeness = getCloseness(bIter->componentSize, bIter->totalDistances, bIter->totalReachable);
-            const PersonId externalPersonId = bIter->person;
-            CentralityResult resultCentrality(externalPersonId, bIter->totalDistances, bIter->totalReachable, closeness);
-
-            // Check if person qualifies as new top k value
-            if(CentralityCmp::compare(make_pair(resultCentrality.person, resultCentrality), state.topResults.getBound())) {
-               // Add improved value to top k list
-               lock_guard<mutex> lock(state.topResultsMutex);
-               state.topResults.insert(resultCentrality.person, resultCentrality);
-            }
-         }
+         addResults(batchData);
       }
 
-      return make_pair(last-begin+1, boundUpdated);
+      return index-begin;
    }
 
    void operator()() {
@@ -216,17 +542,18 @@ public:
 
       PersonId person=rangeStart;
       while(person<rangeEnd) {
-         const auto batchResult = processPersonBatch(person, rangeEnd);
-         person += batchResult.first;
+         person += processPersonBatch(person, rangeEnd);
       }
    }
 };
 }
 
-std::vector<pair<Query4::PersonId,Query4::PersonId>> generateTasks(const uint64_t maxBfs, const Query4::PersonId graphSize, const size_t batchSize);
+/// Splits the first maxBfs persons into morsel tasks. Morsels enlarged for BATCH_REFILL and BATCH_PIPELINE
+/// shrink again as long as there would be fewer than minTasks tasks.
+std::vector<pair<Query4::PersonId,Query4::PersonId>> generateTasks(const uint64_t maxBfs, const Query4::PersonId graphSize, const size_t batchSize, const size_t minTasks);
 
-template<typename BFSRunnerT>
-std::string runBFS(const uint32_t k, const Query4::PersonSubgraph& subgraph, Workers& workers, const uint64_t maxBfs, uint64_t& runtimeOut
+template<typename BFSRunnerT, typename GraphT>
+std::string runBFS(const uint32_t k, const GraphT& subgraph, Workers& workers, const uint64_t maxBfs, uint64_t& runtimeOut
    #ifdef STATISTICS
    , Query4::BatchStatistics& statistics
    #endif
@@ -240,7 +567,7 @@ std::string runBFS(const uint32_t k, const Query4::PersonSubgraph& subgraph, Wor
    // #endif
 
    // Initialize query state
-   Query4::QueryState* queryState = new Query4::QueryState(k, subgraph);
+   Query4::QueryState<GraphT>* queryState = new Query4::QueryState<GraphT>(k, subgraph, Query4::getCentralityMetrics().size());
 
    // Determine bfs order
    std::vector<Query4::PersonId> ids(subgraph.size());
@@ -265,9 +592,9 @@ std::string runBFS(const uint32_t k, const Query4::PersonSubgraph& subgraph, Wor
    // Create bfs tasks from specified subset
    TaskGroup tasks;
    uint64_t numTraversedEdges = 0;
-   auto ranges = generateTasks(maxBfs, subgraph.size(), BFSRunnerT::batchSize());
+   auto ranges = generateTasks(maxBfs, subgraph.size(), BFSRunnerT::batchSize(), (workers.threads.size()+1)*4);
    for(auto& range : ranges) {
-      Query4::MorselTask<BFSRunnerT> bfsTask(*queryState, range.first, range.second, subgraph, ids, start
+      Query4::MorselTask<BFSRunnerT, GraphT> bfsTask(*queryState, range.first, range.second, subgraph, ids, start
          #ifdef STATISTICS
          , statistics
          #endif
@@ -284,7 +611,7 @@ std::string runBFS(const uint32_t k, const Query4::PersonSubgraph& subgraph, Wor
    //std::cout << "# TaskStats "<<maxBfs<<", "<<ranges.size()<< std::endl;
 
    const char* resultChar;
-   tasks.join(LambdaRunner::createLambdaTask(move(Query4::ResultConcatenator(queryState, resultChar
+   tasks.join(LambdaRunner::createLambdaTask(move(Query4::ResultConcatenator<GraphT>(queryState, resultChar
        #ifdef STATISTICS
          , statistics
          #endif
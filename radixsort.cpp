@@ -0,0 +1,116 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "include/radixsort.hpp"
+#include "include/worker.hpp"
+#include "include/log.hpp"
+
+#include <algorithm>
+#include <array>
+
+using namespace std;
+
+namespace {
+   static const unsigned digitBits = 8;
+   static const unsigned numDigits = 64/digitBits;
+   static const size_t numBuckets = 1<<digitBits;
+   // Inputs below this size are not worth the histogram passes
+   static const size_t minRadixSize = 1<<16;
+
+   typedef array<size_t, numBuckets> Histogram;
+
+   inline size_t digit(const uint64_t key, const unsigned d) {
+      return (key>>(d*digitBits))&(numBuckets-1);
+   }
+}
+
+void radix::sortUnique(vector<uint64_t>& keys, Workers& workers) {
+   const size_t n = keys.size();
+   if(n<minRadixSize) {
+      sort(keys.begin(), keys.end());
+      keys.erase(unique(keys.begin(), keys.end()), keys.end());
+      return;
+   }
+
+   const size_t numChunks = workers.threads.size()+1;
+   const size_t chunkSize = n/numChunks+1;
+   auto chunkBegin = [n, chunkSize](size_t c) { return min(c*chunkSize, n); };
+
+   // Global histograms of all digits to detect digits that need no pass
+   vector<array<Histogram, numDigits>> digitHistograms(numChunks);
+   {
+      vector<Task> tasks;
+      for(size_t c=0; c<numChunks; c++) {
+         tasks.push_back(LambdaRunner::createLambdaTask([&keys, &digitHistograms, &chunkBegin, c] {
+            auto& histograms = digitHistograms[c];
+            for(auto& h : histograms) { h.fill(0); }
+            for(size_t i=chunkBegin(c); i<chunkBegin(c+1); i++) {
+               for(unsigned d=0; d<numDigits; d++) {
+                  histograms[d][digit(keys[i], d)]++;
+               }
+            }
+         }));
+      }
+      workers.runAll(move(tasks));
+   }
+
+   vector<uint64_t> scratch(n);
+   uint64_t* src = keys.data();
+   uint64_t* dst = scratch.data();
+   vector<Histogram> chunkHistograms(numChunks);
+   for(unsigned d=0; d<numDigits; d++) {
+      bool trivial=false;
+      for(size_t b=0; b<numBuckets && !trivial; b++) {
+         size_t total=0;
+         for(size_t c=0; c<numChunks; c++) {
+            total += digitHistograms[c][d][b];
+         }
+         trivial = total==n;
+      }
+      if(trivial) {
+         continue;
+      }
+
+      // Histograms of the current key order
+      vector<Task> countTasks;
+      for(size_t c=0; c<numChunks; c++) {
+         countTasks.push_back(LambdaRunner::createLambdaTask([&chunkHistograms, &chunkBegin, src, c, d] {
+            Histogram& h = chunkHistograms[c];
+            h.fill(0);
+            for(size_t i=chunkBegin(c); i<chunkBegin(c+1); i++) {
+               h[digit(src[i], d)]++;
+            }
+         }));
+      }
+      workers.runAll(move(countTasks));
+
+      // Turn counts into write offsets, bucket major so the pass stays stable
+      size_t offset=0;
+      for(size_t b=0; b<numBuckets; b++) {
+         for(size_t c=0; c<numChunks; c++) {
+            const size_t count = chunkHistograms[c][b];
+            chunkHistograms[c][b] = offset;
+            offset += count;
+         }
+      }
+
+      vector<Task> scatterTasks;
+      for(size_t c=0; c<numChunks; c++) {
+         scatterTasks.push_back(LambdaRunner::createLambdaTask([&chunkHistograms, &chunkBegin, src, dst, c, d] {
+            Histogram& writePos = chunkHistograms[c];
+            for(size_t i=chunkBegin(c); i<chunkBegin(c+1); i++) {
+               dst[writePos[digit(src[i], d)]++] = src[i];
+            }
+         }));
+      }
+      workers.runAll(move(scatterTasks));
+      swap(src, dst);
+   }
+
+   if(src!=keys.data()) {
+      keys.swap(scratch);
+   }
+   vector<uint64_t>().swap(scratch);
+
+   keys.erase(unique(keys.begin(), keys.end()), keys.end());
+}
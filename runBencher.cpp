@@ -2,16 +2,9 @@
 //
 //Code must not be used, distributed, without written consent by the authors
 #include "include/bench.hpp"
+#include "include/dispatch.hpp"
 #include "include/TraceStats.hpp"
 
-#define GEN_BENCH_BRANCH(X,CTYPE,WIDTH) \
-   X(batchType==sizeof(CTYPE)*8&&batchWidth==WIDTH) { \
-      bencher = new SpecializedBFSBenchmark<Query4::HugeBatchBfs<CTYPE,WIDTH,false>>("BatchBFS "+std::to_string(sizeof(CTYPE)*8)+" ("+std::to_string(WIDTH)+")"); \
-      maxBatchSize = sizeof(CTYPE)*8*WIDTH; \
-      bfsType = std::to_string(sizeof(CTYPE)*8)+"_"+std::to_string(WIDTH); \
-   } \
-
-
 int main(int argc, char** argv) {
     if(argc!=6 && argc!=7 && argc!=8) {
       FATAL_ERROR("Not enough parameters");
@@ -33,6 +26,7 @@ int main(int argc, char** argv) {
    BFSBenchmark* bencher;
    std::string bfsType;
    Query4::PARABFSRunner::setThreadNum(numThreads);//Using threads inside BFS
+   const std::string graphLayout = getenv("GRAPH_LAYOUT")!=nullptr ? getenv("GRAPH_LAYOUT") : "sizedlist";
    if(std::string(argv[4])=="naive") {
       bencher = new SpecializedBFSBenchmark<Query4::BFSRunner>("BFSRunner");
       maxBatchSize = 1;
@@ -51,15 +45,25 @@ int main(int argc, char** argv) {
       bfsType = "parabfs";
       numThreads = 1;
    } else {
-      const int batchType = std::stoi(std::string(argv[4]));
+      // "auto" picks the widest register type the host supports
+      const dispatch::VectorIsa vectorIsa = dispatch::detectVectorIsa();
+      const int batchType = std::string(argv[4])=="auto" ? static_cast<int>(vectorIsa) : std::stoi(std::string(argv[4]));
       const int batchWidth = std::stoi(std::string(argv[5]));
-      GEN_BENCH_BRANCH(if,__m128i,8)
+      bencher = nullptr;
+      if(batchType==static_cast<int>(dispatch::VectorIsa::Avx512)) {
+         if(vectorIsa<dispatch::VectorIsa::Avx512) {
+            FATAL_ERROR("[Main] BFSType 512 requires AVX-512F and AVX-512BW");
+         }
+         bencher = dispatch::createAvx512Bencher(batchWidth, graphLayout, maxBatchSize, bfsType);
+      } else if(batchType==static_cast<int>(dispatch::VectorIsa::Avx2)) {
+         if(vectorIsa<dispatch::VectorIsa::Avx2) {
+            FATAL_ERROR("[Main] BFSType 256 requires AVX2");
+         }
+         bencher = dispatch::createAvx2Bencher(batchWidth, graphLayout, maxBatchSize, bfsType);
+      }
+      GEN_BENCH_BRANCH(else if,__m128i,8)
       GEN_BENCH_BRANCH(else if,__m128i,4)
       GEN_BENCH_BRANCH(else if,__m128i,1)
-      #ifdef AVX2
-      GEN_BENCH_BRANCH(else if,__m256i,2)
-      GEN_BENCH_BRANCH(else if,__m256i,1)
-      #endif
       GEN_BENCH_BRANCH(else if,uint64_t,8)
       GEN_BENCH_BRANCH(else if,uint64_t,1)
       GEN_BENCH_BRANCH(else if,uint32_t,16)
@@ -68,31 +72,38 @@ int main(int argc, char** argv) {
       GEN_BENCH_BRANCH(else if,uint16_t,1)
       GEN_BENCH_BRANCH(else if,uint8_t,64)
       GEN_BENCH_BRANCH(else if,uint8_t,1)
-      else {
+      if(bencher==nullptr) {
          exit(-1);
       }
    }
 
+   // With BATCH_THREADS>1 every batch is processed by a team, so fewer batches run concurrently
+   const size_t numExecutors = std::max<size_t>(1, numThreads/Query4::BatchTeam::teamSize());
+   if(Query4::BatchTeam::teamSize()>1) {
+      LOG_PRINT("[Main] Running "<< numExecutors <<" batches concurrently with "<< Query4::BatchTeam::teamSize() <<" threads each");
+   }
+
    // Allocate additional worker threads
-   Workers workers(numThreads-1);
+   Workers workers(numExecutors-1);
 
    for(unsigned i=0; i<queries.queries.size(); i++) {
       Query query = queries.queries[i];
       LOG_PRINT("[Main] Executing query "<<query.dataset);
-      auto personGraph = Graph<Query4::PersonId>::loadFromPath(query.dataset);
+      auto personGraph = Graph<Query4::PersonId>::loadFromPath(query.dataset, workers);
       if(bfsLimit>personGraph.size()) {
          bfsLimit=personGraph.size();
       }
       if(checkNumTasks)
       {
-         auto ranges = generateTasks(bfsLimit, personGraph.size(), maxBatchSize);
-         auto desiredTasks=numThreads*3;
+         auto desiredTasks=numExecutors*3;
+         auto ranges = generateTasks(bfsLimit, personGraph.size(), maxBatchSize, desiredTasks);
          if(ranges.size()<desiredTasks) {
             FATAL_ERROR("[Main] Not enough tasks! #Threads="<<numThreads<<", #Tasks="<<ranges.size()<<", #DesiredTasks="<<desiredTasks<<", #maxBatchSize="<<maxBatchSize);
          }
       }
 
       // Run benchmark
+      bencher->prepare(personGraph);
       std::cout<<"# Benchmarking "<<bencher->name<<" ... "<<std::endl<<"# ";
       for(int i=0; i<numRuns; i++) {
          bencher->initTrace(personGraph.numVertices, personGraph.numEdges, numThreads, bfsLimit, bfsType);
@@ -0,0 +1,203 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#pragma once
+
+#include "query4.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace Query4 {
+
+// Normal quantile of the 95% confidence intervals
+static const double sampleConfidenceZ = 1.96;
+
+struct ClosenessEstimate {
+   PersonId person;
+   double estimate;
+   double lower;
+   double upper;
+};
+
+/// Estimates the closeness of all persons from the BFS of uniformly sampled sources (Eppstein and Wang).
+/// Sampling k of the r persons in a component estimates the distance sum of each of its persons as r times
+/// the mean distance to the sampled sources. The intervals use the sample variance of these distances with
+/// the finite population correction, and the closeness is that of the interval's distance sums.
+template<typename BFSRunnerT, typename GraphT>
+class ClosenessSampling {
+   const GraphT& subgraph;
+   Workers& workers;
+   // Sums of the distances and squared distances from the sampled sources to each person
+   std::vector<uint64_t> distanceSums;
+   std::vector<uint64_t> squaredSums;
+   // Number of sampled sources per component
+   std::vector<uint32_t> componentSamples;
+   #ifdef STATISTICS
+   BatchStatistics& statistics;
+   #endif
+
+   struct SampledDistances : public LevelAccumulator {
+      ClosenessSampling& sampling;
+      const unsigned numWords;
+
+      SampledDistances(ClosenessSampling& sampling, size_t numSources)
+         : sampling(sampling), numWords((numSources+63)/64) {
+      }
+
+      void addLevel(BatchBFSdata& /*bfsData*/, uint32_t /*distance*/, uint32_t /*numDiscovered*/) override {
+      }
+
+      bool needsVertices() const override {
+         return true;
+      }
+
+      void addVertex(PersonId person, uint32_t round, const uint64_t* lanes) override {
+         uint64_t numSources=0;
+         for(unsigned w=0; w<numWords; w++) {
+            numSources += __builtin_popcountl(lanes[w]);
+         }
+         __atomic_fetch_add(&sampling.distanceSums[person], numSources*round, __ATOMIC_RELAXED);
+         __atomic_fetch_add(&sampling.squaredSums[person], numSources*round*round, __ATOMIC_RELAXED);
+      }
+   };
+
+   // Same deterministic seed as the random node ordering
+   std::vector<PersonId> sampleSources(size_t numSources) const {
+      std::vector<PersonId> ids(subgraph.size());
+      for(PersonId person=0; person<subgraph.size(); person++) {
+         ids[person] = person;
+      }
+      numSources = std::min(numSources, ids.size());
+      std::mt19937 generator(1987);
+      for(size_t i=0; i<numSources; i++) {
+         std::uniform_int_distribution<size_t> distribution(i, ids.size()-1);
+         std::swap(ids[i], ids[distribution(generator)]);
+      }
+      ids.resize(numSources);
+      return ids;
+   }
+
+   void runBatch(const PersonId* sources, const size_t numSources) {
+      std::vector<BatchBFSdata> batchData;
+      batchData.reserve(numSources);
+      for(size_t i=0; i<numSources; i++) {
+         batchData.push_back(BatchBFSdata(sources[i], subgraph.componentSizes[subgraph.personComponents[sources[i]]]));
+      }
+      SampledDistances sampledDistances(*this, numSources);
+      runBatchWithFeed<BFSRunnerT>(batchData, subgraph
+         #ifdef STATISTICS
+         , statistics
+         #endif
+         , nullptr, nullptr, &sampledDistances, 0);
+   }
+
+   static double closeness(uint32_t componentSize, double distanceSum) {
+      return getCloseness(componentSize, std::llround(distanceSum), componentSize-1);
+   }
+
+   ClosenessEstimate estimate(const PersonId person) const {
+      const uint32_t r = subgraph.componentSizes[subgraph.personComponents[person]];
+      const uint32_t k = componentSamples[subgraph.personComponents[person]];
+      ClosenessEstimate result{person, 0, 0, 0};
+      if(r<=1) {
+         return result;
+      }
+      // Without two samples only the trivial bounds are known, every other person is at least at distance 1
+      if(k<2) {
+         result.upper = closeness(r, r-1);
+         return result;
+      }
+      const double mean = double(distanceSums[person])/k;
+      const double variance = std::max(0.0, (double(squaredSums[person])-mean*distanceSums[person])/(k-1));
+      const double standardError = r*std::sqrt(variance/k*(r-k)/(r-1));
+      const double distanceSum = std::max(double(r-1), r*mean);
+      result.estimate = closeness(r, distanceSum);
+      result.lower = closeness(r, distanceSum+sampleConfidenceZ*standardError);
+      result.upper = closeness(r, std::max(double(r-1), distanceSum-sampleConfidenceZ*standardError));
+      return result;
+   }
+
+public:
+   ClosenessSampling(const GraphT& subgraph, Workers& workers
+      #ifdef STATISTICS
+      , BatchStatistics& statistics
+      #endif
+      )
+      : subgraph(subgraph), workers(workers), distanceSums(subgraph.size(), 0), squaredSums(subgraph.size(), 0), componentSamples(subgraph.componentSizes.size(), 0)
+      #ifdef STATISTICS
+      , statistics(statistics)
+      #endif
+   {
+   }
+
+   /// Estimates of all persons by subgraph id
+   std::vector<ClosenessEstimate> run(const size_t numSources) {
+      const std::vector<PersonId> sources = sampleSources(numSources);
+      for(const PersonId source : sources) {
+         componentSamples[subgraph.personComponents[source]]++;
+      }
+      const size_t batchSize = BFSRunnerT::batchSize();
+      const size_t numBatches = (sources.size()+batchSize-1)/batchSize;
+      workers.runRanges(numBatches, [&](size_t begin, size_t end) {
+         for(size_t b=begin; b<end; b++) {
+            const size_t first = b*batchSize;
+            runBatch(sources.data()+first, std::min(batchSize, sources.size()-first));
+         }
+      });
+
+      std::vector<ClosenessEstimate> estimates;
+      estimates.reserve(subgraph.size());
+      for(PersonId person=0; person<subgraph.size(); person++) {
+         estimates.push_back(estimate(person));
+      }
+      return estimates;
+   }
+};
+
+/// Runs the sampled closeness query, the result lists the k persons with the highest estimates and their
+/// intervals. SAMPLE_OUTPUT names a file that receives the estimates of all persons.
+template<typename BFSRunnerT, typename GraphT>
+std::string runSampledCloseness(const uint32_t k, const GraphT& subgraph, Workers& workers, uint64_t& runtimeOut
+   #ifdef STATISTICS
+   , BatchStatistics& statistics
+   #endif
+   ) {
+   const auto start = tschrono::now();
+   const size_t numSources = getNumSampledSources(BFSRunnerT::batchSize());
+   ClosenessSampling<BFSRunnerT, GraphT> sampling(subgraph, workers
+      #ifdef STATISTICS
+      , statistics
+      #endif
+      );
+   std::vector<ClosenessEstimate> estimates = sampling.run(numSources);
+   runtimeOut = tschrono::now() - start;
+
+   const std::string outputFile = getSampleOutputFile();
+   if(!outputFile.empty()) {
+      std::ofstream output(outputFile);
+      for(const ClosenessEstimate& estimate : estimates) {
+         output<<subgraph.mapInternalNodeId(estimate.person)<<" "<<estimate.estimate<<" "<<estimate.lower<<" "<<estimate.upper<<"\n";
+      }
+      if(!output) {
+         FATAL_ERROR("[Query4] Could not write the estimates to "<<outputFile);
+      }
+   }
+
+   const size_t numTop = std::min(size_t(k), estimates.size());
+   std::partial_sort(estimates.begin(), estimates.begin()+numTop, estimates.end(), [&](const ClosenessEstimate& a, const ClosenessEstimate& b) {
+      return a.estimate!=b.estimate ? a.estimate>b.estimate : subgraph.mapInternalNodeId(a.person)<subgraph.mapInternalNodeId(b.person);
+   });
+   std::ostringstream result;
+   result<<"sources="<<std::min(numSources, size_t(subgraph.size()))<<" top=";
+   for(size_t i=0; i<numTop; i++) {
+      const ClosenessEstimate& estimate = estimates[i];
+      result<<(i>0?"|":"")<<subgraph.mapInternalNodeId(estimate.person)<<":"<<estimate.estimate<<"["<<estimate.lower<<","<<estimate.upper<<"]";
+   }
+   return result.str();
+}
+}
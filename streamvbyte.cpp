@@ -0,0 +1,53 @@
+//Copyright (C) 2014 by Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons Kemper, Huy T. Vo
+//
+//Code must not be used, distributed, without written consent by the authors
+#include "include/streamvbyte.hpp"
+
+using namespace std;
+
+namespace streamvbyte {
+
+uint8_t lengthTable[256];
+uint8_t shuffleTable[256][16] __attribute__ ((aligned(16)));
+
+namespace {
+   struct TableInitializer {
+      TableInitializer() {
+         for(unsigned key=0; key<256; key++) {
+            uint8_t offset = 0;
+            for(unsigned lane=0; lane<4; lane++) {
+               const uint8_t length = ((key>>(2*lane))&3)+1;
+               for(unsigned b=0; b<4; b++) {
+                  // 0x80 zeroes the byte in pshufb
+                  shuffleTable[key][lane*4+b] = b<length ? offset+b : 0x80;
+               }
+               offset += length;
+            }
+            lengthTable[key] = offset;
+         }
+      }
+   };
+   static TableInitializer tableInitializer;
+
+   inline uint32_t byteLength(uint32_t value) {
+      return value<(1u<<8) ? 1 : value<(1u<<16) ? 2 : value<(1u<<24) ? 3 : 4;
+   }
+}
+
+void encodeSorted(const uint32_t* values, size_t count, vector<uint8_t>& out) {
+   const size_t controlPos = out.size();
+   out.resize(controlPos+(count+3)/4, 0);
+
+   uint32_t prev = 0;
+   for(size_t i=0; i<count; i++) {
+      const uint32_t delta = values[i]-prev;
+      prev = values[i];
+      const uint32_t length = byteLength(delta);
+      out[controlPos+i/4] |= (length-1)<<(2*(i%4));
+      for(uint32_t b=0; b<length; b++) {
+         out.push_back(delta>>(8*b));
+      }
+   }
+}
+
+}
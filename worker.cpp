@@ -4,6 +4,8 @@
 #include "include/worker.hpp"
 #include "include/log.hpp"
 
+#include <algorithm>
+
 Workers::Workers(uint32_t numWorkers) : scheduler() {
    LOG_PRINT("[Workers] Allocating worker pool with "<< numWorkers << " workers.");
    for (unsigned i = 0; i < numWorkers; ++i) {
@@ -19,6 +21,43 @@ void Workers::assist(Scheduler& tasks) {
       }));
    }
 }
+void Workers::runAll(std::vector<Task> tasks) {
+   Scheduler taskScheduler;
+   taskScheduler.schedule(tasks);
+   taskScheduler.setCloseOnEmpty();
+
+   // Unlike assist, wait for every helper to leave the scheduler before it goes out of scope
+   std::atomic<size_t> numHelping(threads.size());
+   for (unsigned i = 0; i < threads.size(); ++i) {
+      scheduler.schedule(LambdaRunner::createLambdaTask([&taskScheduler, &numHelping, i] {
+         Executor(taskScheduler,i+1, false).run();
+         numHelping--;
+      }));
+   }
+
+   // Always run one executor on the calling thread
+   Executor executor(taskScheduler, 0, false);
+   executor.run();
+
+   while(numHelping>0) {
+      std::this_thread::yield();
+   }
+}
+
+void Workers::runRanges(size_t count, const std::function<void(size_t,size_t)>& fn) {
+   // Use more ranges than threads for load balancing
+   const size_t numRanges = (threads.size()+1)*4;
+   const size_t rangeSize = count/numRanges+1;
+   std::vector<Task> tasks;
+   for(size_t begin=0; begin<count; begin+=rangeSize) {
+      const size_t end = std::min(begin+rangeSize, count);
+      tasks.push_back(LambdaRunner::createLambdaTask([&fn, begin, end] {
+         fn(begin, end);
+      }));
+   }
+   runAll(std::move(tasks));
+}
+
 void Workers::close() {
    scheduler.setCloseOnEmpty();
    for(auto& thread : threads) {